@@ -152,6 +152,8 @@ Pixel bilinearInterpolasi(const Image *img, float x, float y) {
     /* STEP 1: Batasi koordinat agar tidak keluar dari image */
     maxX = (float)img->width - 1.001f;
     maxY = (float)img->height - 1.001f;
+    if (maxX < 0.0f) maxX = 0.0f;   /* Image selebar/setinggi 1 pixel */
+    if (maxY < 0.0f) maxY = 0.0f;
     x = clamp(x, 0.0f, maxX);
     y = clamp(y, 0.0f, maxY);
 
@@ -412,8 +414,12 @@ void tampilkanKonsep() {
 
 /* ============================================================================
  * MAIN PROGRAM
+ * ============================================================================
+ * Define BILINEAR_NO_MAIN untuk memakai file ini sebagai library
+ * (mis. test_regression.c).
  * ============================================================================ */
 
+#ifndef BILINEAR_NO_MAIN
 int main() {
     /* Tampilkan konsep */
     tampilkanKonsep();
@@ -424,3 +430,4 @@ int main() {
     printf("\nProgram selesai.\n\n");
     return 0;
 }
+#endif /* BILINEAR_NO_MAIN */
@@ -0,0 +1,235 @@
+/**
+ * ============================================================================
+ *              BILINEAR RESIZE DAEMON - Client Library
+ * ============================================================================
+ * Implementasi bilinear_client.h (Linux: memfd + SCM_RIGHTS).
+ * ============================================================================
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "bilinear_client.h"
+
+/* ============================================================================
+ * LOW-LEVEL MESSAGE + FD PASSING
+ * ============================================================================ */
+
+int bilinearSendMsg(int sock, const void *msg, size_t len, int fd) {
+    struct msghdr mh;
+    struct iovec iov;
+    union {
+        char buf[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } ctrl;
+    ssize_t sent;
+
+    memset(&mh, 0, sizeof(mh));
+    iov.iov_base = (void*)msg;
+    iov.iov_len = len;
+    mh.msg_iov = &iov;
+    mh.msg_iovlen = 1;
+
+    if (fd >= 0) {
+        struct cmsghdr *cm;
+
+        memset(&ctrl, 0, sizeof(ctrl));
+        mh.msg_control = ctrl.buf;
+        mh.msg_controllen = sizeof(ctrl.buf);
+
+        cm = CMSG_FIRSTHDR(&mh);
+        cm->cmsg_level = SOL_SOCKET;
+        cm->cmsg_type = SCM_RIGHTS;
+        cm->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cm), &fd, sizeof(int));
+    }
+
+    do {
+        sent = sendmsg(sock, &mh, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+
+    return (sent == (ssize_t)len) ? 0 : -1;
+}
+
+long bilinearRecvMsg(int sock, void *msg, size_t len, int *fd) {
+    struct msghdr mh;
+    struct iovec iov;
+    union {
+        char buf[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } ctrl;
+    struct cmsghdr *cm;
+    ssize_t got;
+
+    *fd = -1;
+
+    memset(&mh, 0, sizeof(mh));
+    iov.iov_base = msg;
+    iov.iov_len = len;
+    mh.msg_iov = &iov;
+    mh.msg_iovlen = 1;
+    mh.msg_control = ctrl.buf;
+    mh.msg_controllen = sizeof(ctrl.buf);
+
+    do {
+        got = recvmsg(sock, &mh, MSG_CMSG_CLOEXEC);
+    } while (got < 0 && errno == EINTR);
+
+    if (got < 0) return -1;
+
+    for (cm = CMSG_FIRSTHDR(&mh); cm; cm = CMSG_NXTHDR(&mh, cm)) {
+        if (cm->cmsg_level == SOL_SOCKET && cm->cmsg_type == SCM_RIGHTS) {
+            memcpy(fd, CMSG_DATA(cm), sizeof(int));
+        }
+    }
+
+    return (long)got;
+}
+
+/* ============================================================================
+ * SHARED BUFFER
+ * ============================================================================ */
+
+int bilinearBufferCreate(BilinearBuffer *buf, int width, int height) {
+    size_t size;
+    void *map;
+
+    memset(buf, 0, sizeof(*buf));
+    buf->fd = -1;
+
+    if (width <= 0 || height <= 0 || width > BILINEAR_MAX_DIM || height > BILINEAR_MAX_DIM) {
+        return BILINEAR_ERR_BADREQ;
+    }
+
+    size = (size_t)width * height * sizeof(BilinearPixel);
+
+    buf->fd = memfd_create("bilinear-buffer", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (buf->fd < 0) return BILINEAR_ERR_NOMEM;
+
+    /* Ukuran dikunci supaya daemon tidak bisa kena SIGBUS */
+    if (ftruncate(buf->fd, (off_t)size) < 0 ||
+        fcntl(buf->fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW) < 0) {
+        close(buf->fd);
+        buf->fd = -1;
+        return BILINEAR_ERR_NOMEM;
+    }
+
+    map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, buf->fd, 0);
+    if (map == MAP_FAILED) {
+        close(buf->fd);
+        buf->fd = -1;
+        return BILINEAR_ERR_NOMEM;
+    }
+
+    buf->data = (BilinearPixel*)map;
+    buf->size = size;
+    buf->width = width;
+    buf->height = height;
+    return BILINEAR_OK;
+}
+
+void bilinearBufferFree(BilinearBuffer *buf) {
+    if (buf->data) munmap(buf->data, buf->size);
+    if (buf->fd >= 0) close(buf->fd);
+    buf->data = NULL;
+    buf->fd = -1;
+    buf->size = 0;
+}
+
+/* ============================================================================
+ * CLIENT
+ * ============================================================================ */
+
+int bilinearClientConnect(BilinearClient *client, const char *path) {
+    struct sockaddr_un addr;
+
+    if (!path) path = BILINEAR_SOCKET_PATH;
+    if (strlen(path) >= sizeof(addr.sun_path)) return BILINEAR_ERR_BADREQ;
+
+    client->nextId = 1;
+    client->sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (client->sock < 0) return BILINEAR_ERR_IO;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    if (connect(client->sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(client->sock);
+        client->sock = -1;
+        return BILINEAR_ERR_IO;
+    }
+
+    return BILINEAR_OK;
+}
+
+void bilinearClientClose(BilinearClient *client) {
+    if (client->sock >= 0) close(client->sock);
+    client->sock = -1;
+}
+
+int bilinearClientResize(BilinearClient *client, const BilinearBuffer *src,
+                         int dstWidth, int dstHeight, BilinearBuffer *out) {
+    BilinearRequest req;
+    BilinearReply reply;
+    struct stat st;
+    size_t size;
+    int fd;
+    void *map;
+
+    memset(out, 0, sizeof(*out));
+    out->fd = -1;
+
+    req.magic = BILINEAR_MAGIC;
+    req.requestId = client->nextId++;
+    req.srcWidth = (uint32_t)src->width;
+    req.srcHeight = (uint32_t)src->height;
+    req.dstWidth = (uint32_t)dstWidth;
+    req.dstHeight = (uint32_t)dstHeight;
+
+    if (bilinearSendMsg(client->sock, &req, sizeof(req), src->fd) < 0) {
+        return BILINEAR_ERR_IO;
+    }
+
+    if (bilinearRecvMsg(client->sock, &reply, sizeof(reply), &fd) != (long)sizeof(reply) ||
+        reply.magic != BILINEAR_MAGIC || reply.requestId != req.requestId) {
+        if (fd >= 0) close(fd);
+        return BILINEAR_ERR_IO;
+    }
+
+    if (reply.status != BILINEAR_OK) {
+        if (fd >= 0) close(fd);
+        return reply.status;
+    }
+    if (fd < 0) return BILINEAR_ERR_IO;
+
+    /* Map hasil langsung dari memfd daemon */
+    size = (size_t)reply.width * reply.height * sizeof(BilinearPixel);
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < size) {
+        close(fd);
+        return BILINEAR_ERR_IO;
+    }
+
+    map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        return BILINEAR_ERR_IO;
+    }
+
+    out->fd = fd;
+    out->data = (BilinearPixel*)map;
+    out->size = size;
+    out->width = (int)reply.width;
+    out->height = (int)reply.height;
+    return BILINEAR_OK;
+}
@@ -0,0 +1,116 @@
+/**
+ * ============================================================================
+ *              BILINEAR RESIZE DAEMON - Client Library & Protocol
+ * ============================================================================
+ * Protokol antara bilinear_daemon dan client (lihat bilinear_daemon.c).
+ *
+ * Transport : Unix domain socket, SOCK_SEQPACKET (1 message = 1 request)
+ * Payload   : Pixel tidak dikirim lewat socket. Source image berada di
+ *             memfd milik client, hasil resize di memfd milik daemon.
+ *             File descriptor dikirim lewat SCM_RIGHTS, lalu di-mmap.
+ *
+ *   client                                   daemon
+ *     | -- BilinearRequest + fd(source) -->    |
+ *     |                                        |  (batch + resize)
+ *     | <-- BilinearReply  + fd(result) ---    |
+ *
+ * Layout pixel di buffer: float r, g, b (sama dengan struct Pixel).
+ *
+ * Sealing: memfd source WAJIB punya F_SEAL_SHRINK (dan F_SEAL_GROW).
+ * Tanpa seal, client bisa mengecilkan file saat daemon sedang membaca
+ * mapping-nya, sehingga daemon mati karena SIGBUS. Request tanpa seal
+ * ditolak dengan BILINEAR_ERR_BADREQ. Memfd hasil dari daemon di-seal
+ * penuh (shrink, grow, write).
+ *
+ * Akses: socket dibuat daemon dengan mode 0600, jadi hanya user yang sama
+ * yang bisa connect (ubah dengan opsi -m daemon).
+ * ============================================================================
+ */
+
+#ifndef BILINEAR_CLIENT_H
+#define BILINEAR_CLIENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BILINEAR_SOCKET_PATH   "/tmp/bilinear.sock"
+#define BILINEAR_MAGIC         0x42494c31u   /* "BIL1" */
+#define BILINEAR_MAX_DIM       32768
+
+/* Status pada BilinearReply */
+#define BILINEAR_OK             0
+#define BILINEAR_ERR_BADREQ    -1   /* Header / ukuran / seal tidak valid, atau output > budget request */
+#define BILINEAR_ERR_NOMEM     -2   /* Gagal alokasi buffer hasil / budget batch penuh (boleh diulang) */
+#define BILINEAR_ERR_IO        -3   /* Gagal kirim/terima atau mmap */
+
+typedef struct {
+    float r, g, b;
+} BilinearPixel;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t requestId;
+    uint32_t srcWidth, srcHeight;
+    uint32_t dstWidth, dstHeight;
+} BilinearRequest;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t requestId;
+    int32_t status;
+    uint32_t width, height;
+} BilinearReply;
+
+/* Buffer pixel yang bisa dibagi antar proses (memfd + mmap) */
+typedef struct {
+    int fd;
+    BilinearPixel *data;
+    size_t size;            /* Ukuran mapping dalam byte */
+    int width;
+    int height;
+} BilinearBuffer;
+
+typedef struct {
+    int sock;
+    uint32_t nextId;
+} BilinearClient;
+
+/**
+ * Buat buffer width x height di memfd yang di-seal terhadap shrink/grow.
+ * Client mengisi buf->data langsung, tanpa copy tambahan saat request
+ * dikirim. Isi buffer tidak di-seal write (client boleh menulis ulang
+ * untuk request berikutnya), jadi jangan menulis saat request berjalan.
+ * @return BILINEAR_OK atau kode error
+ */
+int bilinearBufferCreate(BilinearBuffer *buf, int width, int height);
+
+void bilinearBufferFree(BilinearBuffer *buf);
+
+/** Sambung ke daemon. path == NULL memakai BILINEAR_SOCKET_PATH. */
+int bilinearClientConnect(BilinearClient *client, const char *path);
+
+void bilinearClientClose(BilinearClient *client);
+
+/**
+ * Resize src ke dstWidth x dstHeight (blocking).
+ * Jika sukses, out berisi mapping read-only dari buffer hasil daemon dan
+ * harus dilepas dengan bilinearBufferFree().
+ * @return BILINEAR_OK atau kode error
+ */
+int bilinearClientResize(BilinearClient *client, const BilinearBuffer *src,
+                         int dstWidth, int dstHeight, BilinearBuffer *out);
+
+/* ============================================================================
+ * LOW-LEVEL (dipakai juga oleh daemon)
+ * ============================================================================ */
+
+/** Kirim 1 message + optional fd (fd < 0 = tanpa fd). @return 0 / -1 */
+int bilinearSendMsg(int sock, const void *msg, size_t len, int fd);
+
+/**
+ * Terima 1 message + optional fd (*fd = -1 jika tidak ada).
+ * @return Jumlah byte diterima, 0 jika koneksi ditutup, -1 jika error
+ */
+long bilinearRecvMsg(int sock, void *msg, size_t len, int *fd);
+
+#endif /* BILINEAR_CLIENT_H */
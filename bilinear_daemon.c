@@ -0,0 +1,478 @@
+/**
+ * ============================================================================
+ *              BILINEAR RESIZE DAEMON (Unix Domain Socket)
+ * ============================================================================
+ * Proses resize yang berjalan terus, sehingga setiap request tidak perlu
+ * cold start (spin-up thread team, page fault, cache dingin).
+ *
+ * - Request masuk lewat Unix socket (SOCK_SEQPACKET), protokol di
+ *   bilinear_client.h. Pixel tidak pernah di-copy lewat socket: source
+ *   di-mmap dari memfd client, hasil ditulis langsung ke memfd baru yang
+ *   fd-nya dikirim balik ke client.
+ * - Request kecil yang datang bersamaan dikumpulkan menjadi satu batch
+ *   (menunggu maksimal batch window), lalu semua baris output dari semua
+ *   request dibagi ke SATU thread team OpenMP yang tetap hidup (warm).
+ * - Memori hasil dibatasi: satu request maksimal -r Mpix output (lebih
+ *   besar -> BILINEAR_ERR_BADREQ), dan total output satu batch maksimal
+ *   -b Mpix (request yang tidak muat -> BILINEAR_ERR_NOMEM, client boleh
+ *   mengulang). Tanpa batas ini satu request 32768x32768 saja sudah
+ *   memesan memfd ~12 GiB.
+ * - Socket dibuat dengan mode 0600 (hanya user yang menjalankan daemon).
+ *   Pakai -m 0660 / 0666 untuk membuka akses ke group / semua user.
+ *
+ * Compile:
+ *   gcc -o bilinear_daemon bilinear_daemon.c bilinear_client.c -std=c99 -O3 \
+ *       -fopenmp -DUSE_OPENMP -lm
+ *
+ * Run:
+ *   ./bilinear_daemon [-s socket] [-t threads] [-w window_us]
+ *                     [-r request_mpix] [-b batch_mpix] [-m mode]
+ * ============================================================================
+ */
+
+#define _GNU_SOURCE
+#define BILINEAR_NO_MAIN
+#include "bilinear_openmp.c"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "bilinear_client.h"
+
+#define MAX_CLIENTS         256
+#define BATCH_MAX           64
+#define BATCH_SMALL_PIXELS  (512L * 512)    /* Batch di bawah ini menunggu request lain */
+#define DEFAULT_WINDOW_US   200
+#define DEFAULT_REQUEST_MPIX 32.0           /* Output per request (~384 MiB) */
+#define DEFAULT_BATCH_MPIX  128.0           /* Output per batch (~1.5 GiB) */
+#define DEFAULT_SOCKET_MODE 0600
+
+/* Layout pixel di shared memory harus identik dengan Pixel */
+typedef char pixelLayoutCheck[(sizeof(Pixel) == sizeof(BilinearPixel)) ? 1 : -1];
+
+/* ============================================================================
+ * STRUKTUR DATA
+ * ============================================================================ */
+
+typedef struct {
+    int sock;               /* Koneksi client */
+    BilinearRequest req;
+    int status;
+    Image src;              /* data = mmap memfd client (read-only) */
+    Image dst;              /* data = mmap memfd hasil */
+    size_t srcSize, dstSize;
+    int outFd;
+} Job;
+
+typedef struct {
+    struct pollfd fds[MAX_CLIENTS + 1];  /* fds[0] = listening socket */
+    int busy[MAX_CLIENTS + 1];           /* Koneksi sudah punya job di batch ini */
+    int numFds;
+
+    long maxRequestPixels;               /* Batas output 1 request */
+    long maxBatchPixels;                 /* Batas total output 1 batch */
+
+    long requests, batches;
+} Daemon;
+
+static volatile sig_atomic_t running = 1;
+
+static void onSignal(int sig) {
+    (void)sig;
+    running = 0;
+}
+
+/* ============================================================================
+ * JOB: SETUP, RESIZE, REPLY
+ * ============================================================================ */
+
+/**
+ * Map source dari fd client dan siapkan memfd hasil. batchUsed = pixel
+ * output job lain yang sudah diterima di batch ini.
+ */
+static void prepareJob(const Daemon *d, Job *job, int inFd, long batchUsed) {
+    const BilinearRequest *req = &job->req;
+    struct stat st;
+    void *map;
+    long dstPixels;
+    int seals;
+
+    job->status = BILINEAR_ERR_BADREQ;
+    job->src.data = NULL;
+    job->dst.data = NULL;
+    job->outFd = -1;
+
+    if (req->magic != BILINEAR_MAGIC || inFd < 0 ||
+        req->srcWidth == 0 || req->srcHeight == 0 ||
+        req->dstWidth == 0 || req->dstHeight == 0 ||
+        req->srcWidth > BILINEAR_MAX_DIM || req->srcHeight > BILINEAR_MAX_DIM ||
+        req->dstWidth > BILINEAR_MAX_DIM || req->dstHeight > BILINEAR_MAX_DIM) {
+        if (inFd >= 0) close(inFd);
+        return;
+    }
+
+    /* Cek budget sebelum memfd hasil dibuat */
+    dstPixels = (long)req->dstWidth * req->dstHeight;
+    if (dstPixels > d->maxRequestPixels) {
+        close(inFd);
+        return;
+    }
+    if (batchUsed + dstPixels > d->maxBatchPixels) {
+        job->status = BILINEAR_ERR_NOMEM;
+        close(inFd);
+        return;
+    }
+
+    job->srcSize = (size_t)req->srcWidth * req->srcHeight * sizeof(Pixel);
+    job->dstSize = (size_t)req->dstWidth * req->dstHeight * sizeof(Pixel);
+
+    /*
+     * Tanpa F_SEAL_SHRINK client bisa ftruncate() fd-nya setelah fstat di
+     * bawah, dan akses mapping di processBatch berakhir dengan SIGBUS.
+     */
+    seals = fcntl(inFd, F_GET_SEALS);
+    if (seals < 0 || !(seals & F_SEAL_SHRINK)) {
+        close(inFd);
+        return;
+    }
+
+    if (fstat(inFd, &st) < 0 || (size_t)st.st_size < job->srcSize) {
+        close(inFd);
+        return;
+    }
+
+    map = mmap(NULL, job->srcSize, PROT_READ, MAP_SHARED, inFd, 0);
+    close(inFd);
+    if (map == MAP_FAILED) {
+        job->status = BILINEAR_ERR_IO;
+        return;
+    }
+    job->src.data = (Pixel*)map;
+    job->src.width = (int)req->srcWidth;
+    job->src.height = (int)req->srcHeight;
+
+    job->status = BILINEAR_ERR_NOMEM;
+    job->outFd = memfd_create("bilinear-result", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (job->outFd < 0) return;
+
+    if (ftruncate(job->outFd, (off_t)job->dstSize) < 0) return;
+
+    map = mmap(NULL, job->dstSize, PROT_READ | PROT_WRITE, MAP_SHARED, job->outFd, 0);
+    if (map == MAP_FAILED) return;
+
+    job->dst.data = (Pixel*)map;
+    job->dst.width = (int)req->dstWidth;
+    job->dst.height = (int)req->dstHeight;
+    job->status = BILINEAR_OK;
+}
+
+/**
+ * Resize semua job dalam satu region parallel. Baris output dari semua
+ * request digabung menjadi satu index space, sehingga request kecil
+ * tetap memakai semua thread.
+ */
+static void processBatch(Job *jobs, int numJobs) {
+    long rowStart[BATCH_MAX + 1];
+    long totalRows, r;
+    int j;
+
+    rowStart[0] = 0;
+    for (j = 0; j < numJobs; j++) {
+        int rows = (jobs[j].status == BILINEAR_OK) ? jobs[j].dst.height : 0;
+        rowStart[j + 1] = rowStart[j] + rows;
+    }
+    totalRows = rowStart[numJobs];
+
+#ifdef USE_OPENMP
+    #pragma omp parallel for schedule(dynamic, 4)
+#endif
+    for (r = 0; r < totalRows; r++) {
+        const Job *job;
+        int k = 0, y;
+
+        while (rowStart[k + 1] <= r) k++;
+        job = &jobs[k];
+        y = (int)(r - rowStart[k]);
+
+        /* Kernel baris yang sama dengan resizeSerial (bilinear_openmp.c) */
+        resizeRow(&job->src, &job->dst.data[(long)y * job->dst.width], y, job->dst.width,
+                  (float)job->src.width / job->dst.width,
+                  (float)job->src.height / job->dst.height);
+    }
+}
+
+/* Lepas mapping dan kirim reply + fd hasil ke client */
+static void finishJob(Job *job) {
+    BilinearReply reply;
+
+    if (job->src.data) munmap(job->src.data, job->srcSize);
+    if (job->dst.data) munmap(job->dst.data, job->dstSize);
+
+    /* Hasil read-only untuk client (mapping writable sudah dilepas) */
+    if (job->status == BILINEAR_OK &&
+        fcntl(job->outFd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) < 0) {
+        job->status = BILINEAR_ERR_IO;
+    }
+
+    reply.magic = BILINEAR_MAGIC;
+    reply.requestId = job->req.requestId;
+    reply.status = job->status;
+    reply.width = (job->status == BILINEAR_OK) ? job->req.dstWidth : 0;
+    reply.height = (job->status == BILINEAR_OK) ? job->req.dstHeight : 0;
+
+    /* Jika gagal kirim, koneksi akan terdeteksi tertutup di poll berikutnya */
+    bilinearSendMsg(job->sock, &reply, sizeof(reply),
+                    (job->status == BILINEAR_OK) ? job->outFd : -1);
+
+    if (job->outFd >= 0) close(job->outFd);
+}
+
+/* ============================================================================
+ * KONEKSI & BATCHING
+ * ============================================================================ */
+
+static void closeSlot(Daemon *d, int slot) {
+    close(d->fds[slot].fd);
+    d->numFds--;
+    d->fds[slot] = d->fds[d->numFds];
+    d->busy[slot] = d->busy[d->numFds];
+}
+
+static long batchPixels(const Job *jobs, int numJobs) {
+    long total = 0;
+    int j;
+
+    for (j = 0; j < numJobs; j++) {
+        if (jobs[j].status == BILINEAR_OK) total += (long)jobs[j].dst.width * jobs[j].dst.height;
+    }
+    return total;
+}
+
+/**
+ * Terima koneksi baru dan baca maksimal 1 request per koneksi.
+ * Koneksi yang sudah punya job di batch ini tidak di-poll (events = 0)
+ * supaya koneksinya tidak ditutup sebelum reply dikirim. Setelah budget
+ * batch habis, request berikutnya dibiarkan antre untuk batch berikutnya.
+ */
+static int collectRequests(Daemon *d, Job *jobs, int numJobs) {
+    long used = batchPixels(jobs, numJobs);
+    int i;
+
+    if (d->fds[0].revents & POLLIN) {
+        int conn = accept4(d->fds[0].fd, NULL, NULL, SOCK_CLOEXEC);
+        if (conn >= 0) {
+            if (d->numFds <= MAX_CLIENTS) {
+                d->fds[d->numFds].fd = conn;
+                d->fds[d->numFds].events = POLLIN;
+                d->fds[d->numFds].revents = 0;
+                d->busy[d->numFds] = 0;
+                d->numFds++;
+            } else {
+                close(conn);
+            }
+        }
+    }
+
+    for (i = 1; i < d->numFds && numJobs < BATCH_MAX; i++) {
+        Job *job = &jobs[numJobs];
+        long got;
+        int fd;
+
+        if (d->busy[i] || !(d->fds[i].revents & (POLLIN | POLLHUP | POLLERR))) continue;
+
+        if (used >= d->maxBatchPixels) break;
+
+        got = bilinearRecvMsg(d->fds[i].fd, &job->req, sizeof(job->req), &fd);
+        if (got <= 0) {
+            if (fd >= 0) close(fd);
+            closeSlot(d, i);
+            i--;    /* Slot i sekarang berisi koneksi terakhir */
+            continue;
+        }
+        if (got != (long)sizeof(job->req)) job->req.magic = 0;
+
+        job->sock = d->fds[i].fd;
+        prepareJob(d, job, fd, used);
+        if (job->status == BILINEAR_OK) used += (long)job->dst.width * job->dst.height;
+        d->busy[i] = 1;
+        d->fds[i].events = 0;
+        d->fds[i].revents = 0;
+        numJobs++;
+        d->requests++;
+    }
+
+    return numJobs;
+}
+
+static double monotonicUs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static int pollWithTimeoutUs(Daemon *d, double timeoutUs) {
+    struct timespec ts;
+
+    if (timeoutUs < 0.0) return ppoll(d->fds, d->numFds, NULL, NULL);
+
+    ts.tv_sec = (time_t)(timeoutUs / 1e6);
+    ts.tv_nsec = (long)((timeoutUs - ts.tv_sec * 1e6) * 1e3);
+    return ppoll(d->fds, d->numFds, &ts, NULL);
+}
+
+static void serve(Daemon *d, int windowUs) {
+    Job jobs[BATCH_MAX];
+
+    while (running) {
+        int numJobs = 0, j;
+        double deadline, remaining;
+
+        if (pollWithTimeoutUs(d, -1.0) <= 0) continue;
+        numJobs = collectRequests(d, jobs, numJobs);
+
+        /* Batch masih kecil: tunggu request lain sampai window habis */
+        deadline = monotonicUs() + windowUs;
+        while (running && numJobs > 0 && numJobs < BATCH_MAX) {
+            long pixels = batchPixels(jobs, numJobs);
+            if (pixels >= BATCH_SMALL_PIXELS || pixels >= d->maxBatchPixels) break;
+
+            remaining = deadline - monotonicUs();
+            if (remaining <= 0.0 || pollWithTimeoutUs(d, remaining) <= 0) break;
+            numJobs = collectRequests(d, jobs, numJobs);
+        }
+
+        if (numJobs == 0) continue;
+
+        processBatch(jobs, numJobs);
+        d->batches++;
+
+        for (j = 0; j < numJobs; j++) finishJob(&jobs[j]);
+
+        /* Koneksi busy tidak pernah ditutup selama batch, jadi aman diaktifkan lagi */
+        for (j = 1; j < d->numFds; j++) {
+            d->busy[j] = 0;
+            d->fds[j].events = POLLIN;
+        }
+    }
+}
+
+/* ============================================================================
+ * MAIN
+ * ============================================================================ */
+
+static void printUsage(const char *prog) {
+    printf("Usage: %s [-s socket] [-t threads] [-w window_us]\n", prog);
+    printf("  -s  Socket path (default %s)\n", BILINEAR_SOCKET_PATH);
+    printf("  -t  OpenMP threads (default: jumlah core)\n");
+    printf("  -w  Batch window dalam mikrodetik (default %d)\n", DEFAULT_WINDOW_US);
+    printf("  -r  Maks. output 1 request dalam Mpix (default %.0f)\n", DEFAULT_REQUEST_MPIX);
+    printf("  -b  Maks. total output 1 batch dalam Mpix (default %.0f)\n", DEFAULT_BATCH_MPIX);
+    printf("  -m  Mode socket, oktal (default %04o = hanya owner)\n", DEFAULT_SOCKET_MODE);
+}
+
+int main(int argc, char **argv) {
+    const char *path = BILINEAR_SOCKET_PATH;
+    int threads = maxThreadsAvailable();
+    int windowUs = DEFAULT_WINDOW_US;
+    double requestMpix = DEFAULT_REQUEST_MPIX;
+    double batchMpix = DEFAULT_BATCH_MPIX;
+    long mode = DEFAULT_SOCKET_MODE;
+    mode_t oldMask;
+    struct sockaddr_un addr;
+    struct sigaction sa;
+    Daemon d;
+    int listenFd, i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) {
+            windowUs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            requestMpix = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            batchMpix = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            mode = strtol(argv[++i], NULL, 8);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (strlen(path) >= sizeof(addr.sun_path) || threads < 1 || windowUs < 0 ||
+        requestMpix <= 0.0 || batchMpix < requestMpix || mode < 0 || mode > 0777) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = onSignal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    listenFd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (listenFd < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+
+    /*
+     * Mode socket di-set lewat umask saat bind, bukan chmod setelahnya,
+     * supaya tidak ada jeda di mana socket bisa diakses user lain.
+     */
+    oldMask = umask(~(mode_t)mode & 0777);
+    if (bind(listenFd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(listenFd, 128) < 0) {
+        perror("bind/listen");
+        umask(oldMask);
+        close(listenFd);
+        return 1;
+    }
+    umask(oldMask);
+
+    /* Thread team dibuat sekali di sini dan dipakai ulang oleh semua batch */
+#ifdef USE_OPENMP
+    omp_set_num_threads(threads);
+    #pragma omp parallel
+    {
+        (void)0;
+    }
+#endif
+
+    memset(&d, 0, sizeof(d));
+    d.fds[0].fd = listenFd;
+    d.fds[0].events = POLLIN;
+    d.numFds = 1;
+    d.maxRequestPixels = (long)(requestMpix * 1e6);
+    d.maxBatchPixels = (long)(batchMpix * 1e6);
+
+    printf("bilinear_daemon: listening on %s (mode %04lo, threads %d, window %d us, "
+           "budget %.1f/%.1f Mpix)\n",
+           path, mode, threads, windowUs, requestMpix, batchMpix);
+    fflush(stdout);
+
+    serve(&d, windowUs);
+
+    for (i = 1; i < d.numFds; i++) close(d.fds[i].fd);
+    close(listenFd);
+    unlink(path);
+
+    printf("bilinear_daemon: %ld requests in %ld batches (avg %.2f per batch)\n",
+           d.requests, d.batches, d.batches ? (double)d.requests / d.batches : 0.0);
+    return 0;
+}
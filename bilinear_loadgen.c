@@ -0,0 +1,172 @@
+/**
+ * ============================================================================
+ *              BILINEAR RESIZE DAEMON - Load Generator
+ * ============================================================================
+ * Mengukur latency (p50/p90/p99/max) dan throughput bilinear_daemon dengan
+ * beberapa client concurrent di mesin yang sama. Setiap client adalah
+ * thread dengan koneksi sendiri yang mengirim request secara berurutan.
+ *
+ * Compile:
+ *   gcc -o bilinear_loadgen bilinear_loadgen.c bilinear_client.c -std=c99 -O3 -pthread
+ *
+ * Run (daemon harus sudah berjalan):
+ *   ./bilinear_loadgen [-s socket] [-c clients] [-n requests] [-i src] [-o dst]
+ * ============================================================================
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "bilinear_client.h"
+
+typedef struct {
+    const char *path;
+    int numRequests;
+    int srcSize, dstSize;
+    double *latencies;      /* ms, numRequests entry */
+    int completed;
+    int errors;
+} ClientTask;
+
+static double nowMs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static int compareDouble(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void* clientThread(void *arg) {
+    ClientTask *task = (ClientTask*)arg;
+    BilinearClient client;
+    BilinearBuffer src;
+    int x, y, i;
+
+    if (bilinearClientConnect(&client, task->path) != BILINEAR_OK) {
+        task->errors = task->numRequests;
+        return NULL;
+    }
+    if (bilinearBufferCreate(&src, task->srcSize, task->srcSize) != BILINEAR_OK) {
+        bilinearClientClose(&client);
+        task->errors = task->numRequests;
+        return NULL;
+    }
+
+    /* Gradient pattern, sama dengan createTestImage() */
+    for (y = 0; y < task->srcSize; y++) {
+        for (x = 0; x < task->srcSize; x++) {
+            float val = (float)((x + y) % 256);
+            BilinearPixel *p = &src.data[y * task->srcSize + x];
+            p->r = val;
+            p->g = val;
+            p->b = val;
+        }
+    }
+
+    for (i = 0; i < task->numRequests; i++) {
+        BilinearBuffer out;
+        double start = nowMs();
+        int status = bilinearClientResize(&client, &src, task->dstSize, task->dstSize, &out);
+
+        if (status != BILINEAR_OK) {
+            task->errors++;
+            continue;
+        }
+        task->latencies[task->completed++] = nowMs() - start;
+        bilinearBufferFree(&out);
+    }
+
+    bilinearBufferFree(&src);
+    bilinearClientClose(&client);
+    return NULL;
+}
+
+static double percentile(const double *sorted, int n, double p) {
+    int idx = (int)(p / 100.0 * (n - 1) + 0.5);
+    return sorted[idx];
+}
+
+int main(int argc, char **argv) {
+    const char *path = BILINEAR_SOCKET_PATH;
+    int numClients = 8, numRequests = 200, srcSize = 256, dstSize = 128;
+    pthread_t *threads;
+    ClientTask *tasks;
+    double *all;
+    double start, elapsed;
+    int total = 0, errors = 0, i, j;
+
+    for (i = 1; i < argc; i++) {
+        if (i + 1 >= argc) break;
+        if (strcmp(argv[i], "-s") == 0) path = argv[++i];
+        else if (strcmp(argv[i], "-c") == 0) numClients = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-n") == 0) numRequests = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-i") == 0) srcSize = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-o") == 0) dstSize = atoi(argv[++i]);
+        else break;
+    }
+    if (i < argc || numClients < 1 || numRequests < 1 || srcSize < 1 || dstSize < 1) {
+        printf("Usage: %s [-s socket] [-c clients] [-n requests] [-i src] [-o dst]\n", argv[0]);
+        return 1;
+    }
+
+    threads = (pthread_t*)malloc(numClients * sizeof(pthread_t));
+    tasks = (ClientTask*)calloc(numClients, sizeof(ClientTask));
+    all = (double*)malloc((size_t)numClients * numRequests * sizeof(double));
+    if (!threads || !tasks || !all) {
+        printf("Error: Out of memory\n");
+        return 1;
+    }
+
+    printf("\n");
+    printf("========================================================================\n");
+    printf("      LOAD TEST: BILINEAR DAEMON (%s)\n", path);
+    printf("========================================================================\n\n");
+    printf("Clients: %d  |  Requests/client: %d  |  Resize %dx%d -> %dx%d\n",
+           numClients, numRequests, srcSize, srcSize, dstSize, dstSize);
+    printf("------------------------------------------------------------------------\n");
+
+    start = nowMs();
+    for (i = 0; i < numClients; i++) {
+        tasks[i].path = path;
+        tasks[i].numRequests = numRequests;
+        tasks[i].srcSize = srcSize;
+        tasks[i].dstSize = dstSize;
+        tasks[i].latencies = all + (size_t)i * numRequests;
+        pthread_create(&threads[i], NULL, clientThread, &tasks[i]);
+    }
+    for (i = 0; i < numClients; i++) pthread_join(threads[i], NULL);
+    elapsed = nowMs() - start;
+
+    /* Gabungkan latency semua client */
+    for (i = 0; i < numClients; i++) {
+        for (j = 0; j < tasks[i].completed; j++) all[total++] = tasks[i].latencies[j];
+        errors += tasks[i].errors;
+    }
+
+    if (total == 0) {
+        printf("  Error: No successful requests (is bilinear_daemon running?)\n");
+        return 1;
+    }
+
+    qsort(all, total, sizeof(double), compareDouble);
+
+    printf("  [LATENCY]      p50: %.3f ms  |  p90: %.3f ms  |  p99: %.3f ms  |  max: %.3f ms\n",
+           percentile(all, total, 50.0), percentile(all, total, 90.0),
+           percentile(all, total, 99.0), all[total - 1]);
+    printf("  [THROUGHPUT]   %.0f req/s  (%d ok, %d errors, %.0f ms total)\n",
+           total / (elapsed / 1000.0), total, errors, elapsed);
+    printf("\n========================================================================\n");
+
+    free(all);
+    free(tasks);
+    free(threads);
+    return errors ? 1 : 0;
+}
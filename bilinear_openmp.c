@@ -9,10 +9,14 @@
  * Compile:
  *   Serial:  gcc -o bilinear_serial bilinear_openmp.c -std=c99 -O3
  *   OpenMP:  gcc -o bilinear_omp bilinear_openmp.c -std=c99 -O3 -fopenmp -DUSE_OPENMP
+ *
+ * Autotune:
+ *   ./bilinear_omp --calibrate   (simpan backend terbaik ke bilinear_calib.txt)
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <time.h>
 
@@ -20,6 +24,10 @@
 #include <omp.h>
 #endif
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /* ============================================================================
  * STRUKTUR DATA
  * ============================================================================ */
@@ -34,6 +42,17 @@ typedef struct {
     int height;
 } Image;
 
+/* Pixel RGBA, 4 float = 16 byte: 1 pixel = 1 register SSE */
+typedef struct {
+    float r, g, b, a;   /* Straight (non-premultiplied) alpha, semua 0-255 */
+} PixelRGBA;
+
+typedef struct {
+    PixelRGBA *data;
+    int width;
+    int height;
+} ImageRGBA;
+
 /* ============================================================================
  * FUNGSI UTILITAS IMAGE
  * ============================================================================ */
@@ -69,6 +88,29 @@ void setPixel(Image *img, int x, int y, Pixel p) {
     img->data[y * img->width + x] = p;
 }
 
+ImageRGBA* createImageRGBA(int width, int height) {
+    ImageRGBA *img = (ImageRGBA*)malloc(sizeof(ImageRGBA));
+    if (!img) return NULL;
+
+    img->width = width;
+    img->height = height;
+    img->data = (PixelRGBA*)calloc(width * height, sizeof(PixelRGBA));
+
+    if (!img->data) {
+        free(img);
+        return NULL;
+    }
+
+    return img;
+}
+
+void freeImageRGBA(ImageRGBA *img) {
+    if (img) {
+        if (img->data) free(img->data);
+        free(img);
+    }
+}
+
 /* ============================================================================
  * FUNGSI CLAMP & MIN
  * ============================================================================ */
@@ -83,6 +125,21 @@ int mini(int a, int b) {
     return (a < b) ? a : b;
 }
 
+/* ============================================================================
+ * TIMER
+ * ============================================================================
+ * clock() menghitung CPU time semua thread, sehingga tidak valid untuk
+ * mengukur versi parallel. Dengan OpenMP dipakai wall-clock omp_get_wtime().
+ * ============================================================================ */
+
+double getTimeMs() {
+#ifdef USE_OPENMP
+    return omp_get_wtime() * 1000.0;
+#else
+    return (double)clock() / CLOCKS_PER_SEC * 1000.0;
+#endif
+}
+
 /* ============================================================================
  * BILINEAR INTERPOLATION (Core Algorithm)
  * ============================================================================ */
@@ -96,6 +153,8 @@ Pixel bilinearInterpolate(const Image *img, float x, float y) {
     /* Clamp koordinat */
     maxX = (float)img->width - 1.001f;
     maxY = (float)img->height - 1.001f;
+    if (maxX < 0.0f) maxX = 0.0f;   /* Image selebar/setinggi 1 pixel */
+    if (maxY < 0.0f) maxY = 0.0f;
     x = clampf(x, 0.0f, maxX);
     y = clampf(y, 0.0f, maxY);
 
@@ -129,14 +188,169 @@ Pixel bilinearInterpolate(const Image *img, float x, float y) {
     return result;
 }
 
+/* ============================================================================
+ * KONVERSI sRGB <-> LINEAR LIGHT (Lookup Table)
+ * ============================================================================
+ * Nilai pixel disimpan dalam gamma sRGB (0-255). Interpolasi yang benar
+ * secara fisik harus dilakukan di linear light, tetapi powf() per channel
+ * terlalu mahal. Karena itu konversi dilakukan lewat 2 tabel:
+ *   - Decode: sRGB (0-255) -> linear (0-1), 4096 entry, step 1/16
+ *             (nilai integer 0-255 tepat jatuh di entry tabel)
+ *   - Encode: linear (0-1) -> sRGB (0-255), 4096 entry + interpolasi linear
+ * ============================================================================ */
+
+#define SRGB_DECODE_SCALE     16
+#define SRGB_DECODE_LUT_SIZE  (256 * SRGB_DECODE_SCALE)
+#define SRGB_ENCODE_LUT_SIZE  4096
+
+static float srgbDecodeLut[SRGB_DECODE_LUT_SIZE];
+static float srgbEncodeLut[SRGB_ENCODE_LUT_SIZE + 1];
+static int srgbLutReady = 0;
+
+/* Rumus standar sRGB (dipakai hanya saat membangun tabel) */
+static float srgbToLinearExact(float v) {
+    v = v / 255.0f;
+    if (v <= 0.04045f) return v / 12.92f;
+    return powf((v + 0.055f) / 1.055f, 2.4f);
+}
+
+static float linearToSrgbExact(float v) {
+    if (v <= 0.0031308f) return v * 12.92f * 255.0f;
+    return (1.055f * powf(v, 1.0f / 2.4f) - 0.055f) * 255.0f;
+}
+
+/**
+ * Bangun tabel sekali. Aman dipanggil dari banyak thread sekaligus: flag
+ * dibaca/ditulis atomic (seq_cst), dan pembangunan tabel di dalam critical.
+ */
+void initSrgbLut() {
+    int ready, i;
+
+#ifdef USE_OPENMP
+    #pragma omp atomic read seq_cst
+#endif
+    ready = srgbLutReady;
+    if (ready) return;
+
+#ifdef USE_OPENMP
+    #pragma omp critical(srgbLutInit)
+#endif
+    {
+        if (!srgbLutReady) {
+            for (i = 0; i < SRGB_DECODE_LUT_SIZE; i++) {
+                srgbDecodeLut[i] = srgbToLinearExact((float)i / SRGB_DECODE_SCALE);
+            }
+            for (i = 0; i <= SRGB_ENCODE_LUT_SIZE; i++) {
+                srgbEncodeLut[i] = linearToSrgbExact((float)i / SRGB_ENCODE_LUT_SIZE);
+            }
+
+#ifdef USE_OPENMP
+            #pragma omp atomic write seq_cst
+#endif
+            srgbLutReady = 1;
+        }
+    }
+}
+
+/* sRGB (0-255) -> linear (0-1), nearest entry */
+static inline float srgbDecode(float v) {
+    int idx = (int)(v * SRGB_DECODE_SCALE + 0.5f);
+    if (idx < 0) idx = 0;
+    if (idx >= SRGB_DECODE_LUT_SIZE) idx = SRGB_DECODE_LUT_SIZE - 1;
+    return srgbDecodeLut[idx];
+}
+
+/* linear (0-1) -> sRGB (0-255), interpolasi linear antar entry */
+static inline float srgbEncode(float v) {
+    float pos, frac;
+    int idx;
+
+    pos = clampf(v, 0.0f, 1.0f) * SRGB_ENCODE_LUT_SIZE;
+    idx = (int)pos;
+    if (idx >= SRGB_ENCODE_LUT_SIZE) return srgbEncodeLut[SRGB_ENCODE_LUT_SIZE];
+    frac = pos - (float)idx;
+    return srgbEncodeLut[idx] + (srgbEncodeLut[idx + 1] - srgbEncodeLut[idx]) * frac;
+}
+
+/**
+ * Bilinear interpolation di linear light.
+ * Sama dengan bilinearInterpolate(), tetapi 4 tetangga di-decode saat load
+ * dan hasilnya di-encode kembali ke sRGB saat store (satu pass, tanpa
+ * image perantara). Untuk resize seluruh image pakai resizeSerialLinear(),
+ * yang men-decode tiap baris sumber sekali (lihat resizeRowLinear).
+ * Tabel sRGB dibangun otomatis pada panggilan pertama.
+ */
+Pixel bilinearInterpolateLinear(const Image *img, float x, float y) {
+    float maxX, maxY, fx, fy;
+    int x0, y0, x1, y1;
+    Pixel f00, f10, f01, f11, result;
+    float w00, w10, w01, w11;
+
+    initSrgbLut();
+
+    /* Clamp koordinat */
+    maxX = (float)img->width - 1.001f;
+    maxY = (float)img->height - 1.001f;
+    if (maxX < 0.0f) maxX = 0.0f;   /* Image selebar/setinggi 1 pixel */
+    if (maxY < 0.0f) maxY = 0.0f;
+    x = clampf(x, 0.0f, maxX);
+    y = clampf(y, 0.0f, maxY);
+
+    /* Tentukan 4 pixel tetangga */
+    x0 = (int)floor(x);
+    y0 = (int)floor(y);
+    x1 = mini(x0 + 1, img->width - 1);
+    y1 = mini(y0 + 1, img->height - 1);
+
+    /* Hitung fraksi */
+    fx = x - (float)x0;
+    fy = y - (float)y0;
+
+    /* Ambil nilai 4 tetangga */
+    f00 = getPixel(img, x0, y0);
+    f10 = getPixel(img, x1, y0);
+    f01 = getPixel(img, x0, y1);
+    f11 = getPixel(img, x1, y1);
+
+    /* Hitung bobot */
+    w00 = (1.0f - fx) * (1.0f - fy);
+    w10 = fx * (1.0f - fy);
+    w01 = (1.0f - fx) * fy;
+    w11 = fx * fy;
+
+    /* Decode -> weighted sum -> encode */
+    result.r = srgbEncode(srgbDecode(f00.r) * w00 + srgbDecode(f10.r) * w10 +
+                          srgbDecode(f01.r) * w01 + srgbDecode(f11.r) * w11);
+    result.g = srgbEncode(srgbDecode(f00.g) * w00 + srgbDecode(f10.g) * w10 +
+                          srgbDecode(f01.g) * w01 + srgbDecode(f11.g) * w11);
+    result.b = srgbEncode(srgbDecode(f00.b) * w00 + srgbDecode(f10.b) * w10 +
+                          srgbDecode(f01.b) * w01 + srgbDecode(f11.b) * w11);
+
+    return result;
+}
+
 /* ============================================================================
  * RESIZE IMAGE - SERIAL
  * ============================================================================ */
 
+/**
+ * Hitung 1 baris output (baris y) ke destRow. Dipakai resizeSerial dan
+ * bilinear_daemon.c, sehingga mapping koordinatnya selalu identik.
+ */
+static void resizeRow(const Image *source, Pixel *destRow, int y, int newWidth,
+                      float scaleX, float scaleY) {
+    float srcY = y * scaleY;
+    int x;
+
+    for (x = 0; x < newWidth; x++) {
+        destRow[x] = bilinearInterpolate(source, x * scaleX, srcY);
+    }
+}
+
 Image* resizeSerial(const Image *source, int newWidth, int newHeight) {
     Image *dest;
     float scaleX, scaleY;
-    int x, y;
+    int y;
 
     dest = createImage(newWidth, newHeight);
     if (!dest) return NULL;
@@ -146,12 +360,7 @@ Image* resizeSerial(const Image *source, int newWidth, int newHeight) {
 
     /* Loop serial - sequential */
     for (y = 0; y < newHeight; y++) {
-        for (x = 0; x < newWidth; x++) {
-            float srcX = x * scaleX;
-            float srcY = y * scaleY;
-            Pixel p = bilinearInterpolate(source, srcX, srcY);
-            setPixel(dest, x, y, p);
-        }
+        resizeRow(source, &dest->data[y * newWidth], y, newWidth, scaleX, scaleY);
     }
 
     return dest;
@@ -191,114 +400,1495 @@ Image* resizeOpenMP(const Image *source, int newWidth, int newHeight, int numThr
 #endif
 
 /* ============================================================================
- * CREATE TEST IMAGE
+ * RESIZE IMAGE - OPENMP TILED
+ * ============================================================================
+ * Output dibagi menjadi tile tileSize x tileSize. Setiap thread mengerjakan
+ * satu tile penuh, sehingga baris sumber yang dibaca tetap berada di cache.
  * ============================================================================ */
 
-Image* createTestImage(int size) {
-    Image *img;
-    int x, y;
+#ifdef USE_OPENMP
+Image* resizeOpenMPTiled(const Image *source, int newWidth, int newHeight,
+                         int numThreads, int tileSize) {
+    Image *dest;
+    float scaleX, scaleY;
+    int tilesX, tilesY, t;
 
-    img = createImage(size, size);
-    if (!img) return NULL;
+    dest = createImage(newWidth, newHeight);
+    if (!dest) return NULL;
 
-    /* Isi dengan gradient pattern */
-    for (y = 0; y < size; y++) {
-        for (x = 0; x < size; x++) {
-            float val = (float)((x + y) % 256);
-            Pixel p;
-            p.r = val;
-            p.g = val;
-            p.b = val;
-            setPixel(img, x, y, p);
+    scaleX = (float)source->width / newWidth;
+    scaleY = (float)source->height / newHeight;
+
+    tilesX = (newWidth + tileSize - 1) / tileSize;
+    tilesY = (newHeight + tileSize - 1) / tileSize;
+
+    omp_set_num_threads(numThreads);
+
+    /* Loop parallel per tile */
+    #pragma omp parallel for schedule(dynamic)
+    for (t = 0; t < tilesX * tilesY; t++) {
+        int x0 = (t % tilesX) * tileSize;
+        int y0 = (t / tilesX) * tileSize;
+        int x1 = mini(x0 + tileSize, newWidth);
+        int y1 = mini(y0 + tileSize, newHeight);
+        int x, y;
+
+        for (y = y0; y < y1; y++) {
+            for (x = x0; x < x1; x++) {
+                float srcX = x * scaleX;
+                float srcY = y * scaleY;
+                Pixel p = bilinearInterpolate(source, srcX, srcY);
+                setPixel(dest, x, y, p);
+            }
         }
     }
 
-    return img;
+    return dest;
 }
+#endif
 
 /* ============================================================================
- * BENCHMARK FUNCTION
+ * RESIZE IMAGE - LINEAR LIGHT (sRGB-correct)
  * ============================================================================ */
 
-void runBenchmark() {
-    int testSizes[] = {512, 1024, 2048};
-    int numTests = 3;
-    int targetSize = 2048;
-    int t, i;
+/**
+ * Kolom sumber untuk setiap x output (x0 dan fraksi fx), dihitung sekali
+ * per resize dan dipakai bersama oleh semua baris/thread. Dipakai kernel
+ * linear light dan RGBA.
+ */
+typedef struct {
+    int *x0;
+    float *fx;
+    int sparse;     /* 1: decode hanya kolom yang dipakai (downscale kuat) */
+} ResizeColumns;
+
+static int prepareColumns(ResizeColumns *cols, int srcWidth, int newWidth, float scaleX) {
+    float maxX = (float)srcWidth - 1.001f;
+    int x;
+
+    if (maxX < 0.0f) maxX = 0.0f;
+
+    cols->x0 = (int*)malloc(newWidth * sizeof(int));
+    cols->fx = (float*)malloc(newWidth * sizeof(float));
+    if (!cols->x0 || !cols->fx) {
+        free(cols->x0);
+        free(cols->fx);
+        return 0;
+    }
 
-    printf("\n");
-    printf("========================================================================\n");
-    printf("      BENCHMARK: BILINEAR INTERPOLATION (Pure C with OpenMP)\n");
-    printf("========================================================================\n\n");
+    for (x = 0; x < newWidth; x++) {
+        float srcX = clampf(x * scaleX, 0.0f, maxX);
+        cols->x0[x] = (int)floor(srcX);
+        cols->fx[x] = srcX - (float)cols->x0[x];
+    }
 
-    for (t = 0; t < numTests; t++) {
-        int size = testSizes[t];
-        Image *testImg;
-        Image *resultSerial;
-        clock_t startTime, endTime;
-        double timeSerial;
+    /* Decode 1 baris penuh lebih murah selama lebar sumber <= 2x output */
+    cols->sparse = srcWidth > 2 * newWidth;
+    return 1;
+}
 
-        printf("Test: Resize %dx%d -> %dx%d\n", size, size, targetSize, targetSize);
-        printf("------------------------------------------------------------------------\n");
+static void freeColumns(ResizeColumns *cols) {
+    free(cols->x0);
+    free(cols->fx);
+}
 
-        /* Create test image */
-        testImg = createTestImage(size);
-        if (!testImg) {
-            printf("Error: Failed to create test image\n");
-            continue;
+/* Decode 1 baris sumber ke linear light (hanya kolom yang dipakai jika sparse) */
+static void decodeRowLinear(const Image *source, int y, const ResizeColumns *cols,
+                            int newWidth, Pixel *out) {
+    const Pixel *row = &source->data[y * source->width];
+    int x;
+
+    if (cols->sparse) {
+        for (x = 0; x < newWidth; x++) {
+            int x0 = cols->x0[x];
+            int x1 = mini(x0 + 1, source->width - 1);
+
+            out[x0].r = srgbDecode(row[x0].r);
+            out[x0].g = srgbDecode(row[x0].g);
+            out[x0].b = srgbDecode(row[x0].b);
+            out[x1].r = srgbDecode(row[x1].r);
+            out[x1].g = srgbDecode(row[x1].g);
+            out[x1].b = srgbDecode(row[x1].b);
         }
+        return;
+    }
 
-        /* BENCHMARK SERIAL */
-        startTime = clock();
-        resultSerial = resizeSerial(testImg, targetSize, targetSize);
-        endTime = clock();
-        timeSerial = ((double)(endTime - startTime)) / CLOCKS_PER_SEC * 1000.0;
+    for (x = 0; x < source->width; x++) {
+        out[x].r = srgbDecode(row[x].r);
+        out[x].g = srgbDecode(row[x].g);
+        out[x].b = srgbDecode(row[x].b);
+    }
+}
 
-        printf("  [SERIAL]       Time: %7.0f ms\n", timeSerial);
+/**
+ * Hitung 1 baris output di linear light. cache berisi 2 baris sumber yang
+ * sudah di-decode (cachedY = indeks barisnya); baris hanya di-decode ulang
+ * saat y0 berubah, dan baris bawah dipakai ulang saat turun 1 baris.
+ * Jadi setiap baris sumber di-decode sekali, bukan 4 tetangga per pixel.
+ */
+static void resizeRowLinear(const Image *source, Pixel *destRow, int y, int newWidth,
+                            float scaleY, const ResizeColumns *cols,
+                            Pixel *cache[2], int cachedY[2]) {
+    float maxY = (float)source->height - 1.001f;
+    const Pixel *lin0, *lin1;
+    float srcY, fy;
+    int x, y0, y1;
+
+    if (maxY < 0.0f) maxY = 0.0f;
+
+    srcY = clampf(y * scaleY, 0.0f, maxY);
+    y0 = (int)floor(srcY);
+    y1 = mini(y0 + 1, source->height - 1);
+    fy = srcY - (float)y0;
+
+    if (cachedY[0] != y0) {
+        if (cachedY[1] == y0) {
+            Pixel *tmp = cache[0];
+            cache[0] = cache[1];
+            cache[1] = tmp;
+            cachedY[0] = y0;
+            cachedY[1] = -1;
+        } else {
+            decodeRowLinear(source, y0, cols, newWidth, cache[0]);
+            cachedY[0] = y0;
+        }
+    }
+    if (cachedY[1] != y1) {
+        decodeRowLinear(source, y1, cols, newWidth, cache[1]);
+        cachedY[1] = y1;
+    }
 
-        if (resultSerial) freeImage(resultSerial);
+    lin0 = cache[0];
+    lin1 = cache[1];
+
+    for (x = 0; x < newWidth; x++) {
+        int x0 = cols->x0[x];
+        int x1 = mini(x0 + 1, source->width - 1);
+        float fx = cols->fx[x];
+        float top, bottom;
+
+        top = lin0[x0].r + (lin0[x1].r - lin0[x0].r) * fx;
+        bottom = lin1[x0].r + (lin1[x1].r - lin1[x0].r) * fx;
+        destRow[x].r = srgbEncode(top + (bottom - top) * fy);
+
+        top = lin0[x0].g + (lin0[x1].g - lin0[x0].g) * fx;
+        bottom = lin1[x0].g + (lin1[x1].g - lin1[x0].g) * fx;
+        destRow[x].g = srgbEncode(top + (bottom - top) * fy);
+
+        top = lin0[x0].b + (lin0[x1].b - lin0[x0].b) * fx;
+        bottom = lin1[x0].b + (lin1[x1].b - lin1[x0].b) * fx;
+        destRow[x].b = srgbEncode(top + (bottom - top) * fy);
+    }
+}
+
+Image* resizeSerialLinear(const Image *source, int newWidth, int newHeight) {
+    Image *dest;
+    ResizeColumns cols;
+    Pixel *buffer, *cache[2];
+    int cachedY[2] = {-1, -1};
+    float scaleY;
+    int y;
+
+    dest = createImage(newWidth, newHeight);
+    if (!dest) return NULL;
+
+    initSrgbLut();
+
+    buffer = (Pixel*)malloc(2 * source->width * sizeof(Pixel));
+    if (!buffer || !prepareColumns(&cols, source->width, newWidth,
+                                   (float)source->width / newWidth)) {
+        free(buffer);
+        freeImage(dest);
+        return NULL;
+    }
+    cache[0] = buffer;
+    cache[1] = buffer + source->width;
+
+    scaleY = (float)source->height / newHeight;
+
+    for (y = 0; y < newHeight; y++) {
+        resizeRowLinear(source, &dest->data[y * newWidth], y, newWidth,
+                        scaleY, &cols, cache, cachedY);
+    }
+
+    freeColumns(&cols);
+    free(buffer);
+    return dest;
+}
 
-        /* BENCHMARK OPENMP */
 #ifdef USE_OPENMP
-        {
-            int threadCounts[] = {2, 4, 8};
-            int numThreadTests = 3;
+Image* resizeOpenMPLinear(const Image *source, int newWidth, int newHeight, int numThreads) {
+    Image *dest;
+    ResizeColumns cols;
+    Pixel *buffer;
+    float scaleY;
 
-            for (i = 0; i < numThreadTests; i++) {
-                int threads = threadCounts[i];
-                Image *resultOmp;
-                double timeOmp, speedup;
+    dest = createImage(newWidth, newHeight);
+    if (!dest) return NULL;
 
-                startTime = clock();
-                resultOmp = resizeOpenMP(testImg, targetSize, targetSize, threads);
-                endTime = clock();
-                timeOmp = ((double)(endTime - startTime)) / CLOCKS_PER_SEC * 1000.0;
+    /* Tabel dibangun sekali sebelum masuk region parallel */
+    initSrgbLut();
 
-                speedup = timeSerial / timeOmp;
-                printf("  [OpenMP-%d]     Time: %7.0f ms  |  Speedup: %.2fx\n",
-                       threads, timeOmp, speedup);
+    /* Cache 2 baris per thread */
+    buffer = (Pixel*)malloc((size_t)numThreads * 2 * source->width * sizeof(Pixel));
+    if (!buffer || !prepareColumns(&cols, source->width, newWidth,
+                                   (float)source->width / newWidth)) {
+        free(buffer);
+        freeImage(dest);
+        return NULL;
+    }
 
-                if (resultOmp) freeImage(resultOmp);
-            }
-        }
-#else
-        printf("  [OpenMP]       Not compiled (compile with -fopenmp -DUSE_OPENMP)\n");
-#endif
+    scaleY = (float)source->height / newHeight;
 
-        printf("\n");
-        freeImage(testImg);
+    omp_set_num_threads(numThreads);
+
+    #pragma omp parallel
+    {
+        Pixel *cache[2];
+        int cachedY[2] = {-1, -1};
+        int y;
+
+        cache[0] = buffer + (size_t)omp_get_thread_num() * 2 * source->width;
+        cache[1] = cache[0] + source->width;
+
+        /* Static: tiap thread dapat baris berurutan, cache tetap terpakai */
+        #pragma omp for schedule(static)
+        for (y = 0; y < newHeight; y++) {
+            resizeRowLinear(source, &dest->data[y * newWidth], y, newWidth,
+                            scaleY, &cols, cache, cachedY);
+        }
     }
 
-    printf("========================================================================\n");
+    freeColumns(&cols);
+    free(buffer);
+    return dest;
 }
+#endif
 
 /* ============================================================================
- * PRINT CONCEPT
+ * RGBA - PREMULTIPLIED ALPHA (Single Pass)
+ * ============================================================================
+ * Interpolasi straight alpha secara langsung menghasilkan fringe (warna
+ * pixel transparan ikut tercampur). Solusi standar: premultiply ->
+ * resize -> unpremultiply, tetapi itu 3 pass memory. Di sini ketiganya
+ * digabung di kernel: baris sumber di-premultiply sekali ke cache 2 baris
+ * (seperti kernel linear light), hasil di-unpremultiply saat store.
+ *
+ * Dengan SSE, 1 pixel RGBA = 1 register __m128, sehingga 4 channel
+ * dihitung sekaligus.
  * ============================================================================ */
 
-void printConcept() {
-    printf("\n");
-    printf("========================================================================\n");
+/*
+ * Alpha hasil di bawah ini dianggap transparan penuh (rgb = 0). Tanpa batas
+ * ini, 1/a untuk alpha sangat kecil / denormal overflow ke inf.
+ */
+#define RGBA_ALPHA_EPS  1e-6f
+
+#if defined(__SSE2__)
+/* (r, g, b, a) -> (r*a/255, g*a/255, b*a/255, a) */
+static inline __m128 premultiplySSE(__m128 p) {
+    const __m128 k = _mm_set_ps(0.0f, 1.0f / 255.0f, 1.0f / 255.0f, 1.0f / 255.0f);
+    const __m128 e3 = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+    __m128 a = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_mul_ps(p, _mm_add_ps(_mm_mul_ps(a, k), e3));
+}
+#endif
+
+static inline void premultiplyRGBA(const PixelRGBA *in, PixelRGBA *out) {
+#if defined(__SSE2__)
+    _mm_storeu_ps(&out->r, premultiplySSE(_mm_loadu_ps(&in->r)));
+#else
+    float s = in->a * (1.0f / 255.0f);
+
+    out->r = in->r * s;
+    out->g = in->g * s;
+    out->b = in->b * s;
+    out->a = in->a;
+#endif
+}
+
+/**
+ * Inti kernel RGBA: interpolasi 4 tetangga yang SUDAH premultiplied,
+ * unpremultiply, lalu tulis langsung ke out (straight alpha).
+ */
+static inline void interpolatePremultipliedRGBA(const PixelRGBA *p00, const PixelRGBA *p10,
+                                                const PixelRGBA *p01, const PixelRGBA *p11,
+                                                float fx, float fy, PixelRGBA *out) {
+#if defined(__SSE2__)
+    const __m128 eps = _mm_set1_ps(RGBA_ALPHA_EPS);
+    const __m128 alphaLane = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+    __m128 acc, a, safe, inv, rgb;
+
+    /*
+     * Weighted sum (premultiplied). Semua suku non-negatif, sehingga tidak
+     * ada cancellation saat alpha hasil sangat kecil (berbeda dengan bentuk
+     * lerp a + (b - a) * f).
+     */
+    acc = _mm_mul_ps(_mm_loadu_ps(&p00->r), _mm_set1_ps((1.0f - fx) * (1.0f - fy)));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&p10->r), _mm_set1_ps(fx * (1.0f - fy))));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&p01->r), _mm_set1_ps((1.0f - fx) * fy)));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&p11->r), _mm_set1_ps(fx * fy)));
+
+    /*
+     * Unpremultiply: rgb * 255 / a (rcp + 1 iterasi Newton), 0 jika
+     * a <= RGBA_ALPHA_EPS. rcp dihitung dari max(a, eps) supaya tidak pernah
+     * inf; alpha lane diambil langsung dari acc, tidak lewat inv.
+     */
+    a = _mm_shuffle_ps(acc, acc, _MM_SHUFFLE(3, 3, 3, 3));
+    safe = _mm_max_ps(a, eps);
+    inv = _mm_rcp_ps(safe);
+    inv = _mm_sub_ps(_mm_add_ps(inv, inv), _mm_mul_ps(safe, _mm_mul_ps(inv, inv)));
+    inv = _mm_and_ps(inv, _mm_cmpgt_ps(a, eps));
+    rgb = _mm_mul_ps(acc, _mm_mul_ps(inv, _mm_set1_ps(255.0f)));
+
+    _mm_storeu_ps(&out->r, _mm_or_ps(_mm_andnot_ps(alphaLane, rgb), _mm_and_ps(alphaLane, acc)));
+#else
+    float w00 = (1.0f - fx) * (1.0f - fy);
+    float w10 = fx * (1.0f - fy);
+    float w01 = (1.0f - fx) * fy;
+    float w11 = fx * fy;
+    float a, inv;
+
+    /* Alpha hasil; RGB di bawah = weighted sum premultiplied * 255 / a */
+    a = p00->a * w00 + p10->a * w10 + p01->a * w01 + p11->a * w11;
+
+    inv = (a > RGBA_ALPHA_EPS) ? 255.0f / a : 0.0f;
+    out->r = (p00->r * w00 + p10->r * w10 + p01->r * w01 + p11->r * w11) * inv;
+    out->g = (p00->g * w00 + p10->g * w10 + p01->g * w01 + p11->g * w11) * inv;
+    out->b = (p00->b * w00 + p10->b * w10 + p01->b * w01 + p11->b * w11) * inv;
+    out->a = a;
+#endif
+}
+
+PixelRGBA bilinearInterpolateRGBA(const ImageRGBA *img, float x, float y) {
+    float maxX, maxY;
+    int x0, y0, x1, y1;
+    PixelRGBA p00, p10, p01, p11, result;
+
+    /* Clamp koordinat */
+    maxX = (float)img->width - 1.001f;
+    maxY = (float)img->height - 1.001f;
+    if (maxX < 0.0f) maxX = 0.0f;   /* Image selebar/setinggi 1 pixel */
+    if (maxY < 0.0f) maxY = 0.0f;
+    x = clampf(x, 0.0f, maxX);
+    y = clampf(y, 0.0f, maxY);
+
+    /* Tentukan 4 pixel tetangga */
+    x0 = (int)floor(x);
+    y0 = (int)floor(y);
+    x1 = mini(x0 + 1, img->width - 1);
+    y1 = mini(y0 + 1, img->height - 1);
+
+    premultiplyRGBA(&img->data[y0 * img->width + x0], &p00);
+    premultiplyRGBA(&img->data[y0 * img->width + x1], &p10);
+    premultiplyRGBA(&img->data[y1 * img->width + x0], &p01);
+    premultiplyRGBA(&img->data[y1 * img->width + x1], &p11);
+
+    interpolatePremultipliedRGBA(&p00, &p10, &p01, &p11, x - (float)x0, y - (float)y0, &result);
+    return result;
+}
+
+/* Premultiply 1 baris sumber (hanya kolom yang dipakai jika sparse) */
+static void premultiplyRowRGBA(const ImageRGBA *source, int y, const ResizeColumns *cols,
+                               int newWidth, PixelRGBA *out) {
+    const PixelRGBA *row = &source->data[y * source->width];
+    int x;
+
+    if (cols->sparse) {
+        for (x = 0; x < newWidth; x++) {
+            int x0 = cols->x0[x];
+            int x1 = mini(x0 + 1, source->width - 1);
+
+            premultiplyRGBA(&row[x0], &out[x0]);
+            premultiplyRGBA(&row[x1], &out[x1]);
+        }
+        return;
+    }
+
+    for (x = 0; x < source->width; x++) {
+        premultiplyRGBA(&row[x], &out[x]);
+    }
+}
+
+/**
+ * Hitung 1 baris output. cache berisi 2 baris sumber yang sudah
+ * di-premultiply (cachedY = indeks barisnya), dengan aturan reuse yang sama
+ * seperti resizeRowLinear: setiap baris sumber di-premultiply sekali, bukan
+ * 4 tetangga per pixel output. Kolom (x0, fx) diambil dari tabel cols.
+ */
+static void resizeRowRGBA(const ImageRGBA *source, PixelRGBA *destRow, int y, int newWidth,
+                          float scaleY, const ResizeColumns *cols,
+                          PixelRGBA *cache[2], int cachedY[2]) {
+    float maxY = (float)source->height - 1.001f;
+    const PixelRGBA *row0, *row1;
+    float srcY, fy;
+    int x, y0, y1;
+
+    if (maxY < 0.0f) maxY = 0.0f;
+
+    srcY = clampf(y * scaleY, 0.0f, maxY);
+    y0 = (int)floor(srcY);
+    y1 = mini(y0 + 1, source->height - 1);
+    fy = srcY - (float)y0;
+
+    if (cachedY[0] != y0) {
+        if (cachedY[1] == y0) {
+            PixelRGBA *tmp = cache[0];
+            cache[0] = cache[1];
+            cache[1] = tmp;
+            cachedY[0] = y0;
+            cachedY[1] = -1;
+        } else {
+            premultiplyRowRGBA(source, y0, cols, newWidth, cache[0]);
+            cachedY[0] = y0;
+        }
+    }
+    if (cachedY[1] != y1) {
+        premultiplyRowRGBA(source, y1, cols, newWidth, cache[1]);
+        cachedY[1] = y1;
+    }
+
+    row0 = cache[0];
+    row1 = cache[1];
+
+    for (x = 0; x < newWidth; x++) {
+        int x0 = cols->x0[x];
+        int x1 = mini(x0 + 1, source->width - 1);
+
+        interpolatePremultipliedRGBA(&row0[x0], &row0[x1], &row1[x0], &row1[x1],
+                                     cols->fx[x], fy, &destRow[x]);
+    }
+}
+
+ImageRGBA* resizeSerialRGBA(const ImageRGBA *source, int newWidth, int newHeight) {
+    ImageRGBA *dest;
+    ResizeColumns cols;
+    PixelRGBA *buffer, *cache[2];
+    int cachedY[2] = {-1, -1};
+    float scaleY;
+    int y;
+
+    dest = createImageRGBA(newWidth, newHeight);
+    if (!dest) return NULL;
+
+    buffer = (PixelRGBA*)malloc(2 * source->width * sizeof(PixelRGBA));
+    if (!buffer || !prepareColumns(&cols, source->width, newWidth,
+                                   (float)source->width / newWidth)) {
+        free(buffer);
+        freeImageRGBA(dest);
+        return NULL;
+    }
+    cache[0] = buffer;
+    cache[1] = buffer + source->width;
+
+    scaleY = (float)source->height / newHeight;
+
+    for (y = 0; y < newHeight; y++) {
+        resizeRowRGBA(source, &dest->data[y * newWidth], y, newWidth,
+                      scaleY, &cols, cache, cachedY);
+    }
+
+    freeColumns(&cols);
+    free(buffer);
+    return dest;
+}
+
+#ifdef USE_OPENMP
+ImageRGBA* resizeOpenMPRGBA(const ImageRGBA *source, int newWidth, int newHeight, int numThreads) {
+    ImageRGBA *dest;
+    ResizeColumns cols;
+    PixelRGBA *buffer;
+    float scaleY;
+
+    dest = createImageRGBA(newWidth, newHeight);
+    if (!dest) return NULL;
+
+    /* Cache 2 baris per thread */
+    buffer = (PixelRGBA*)malloc((size_t)numThreads * 2 * source->width * sizeof(PixelRGBA));
+    if (!buffer || !prepareColumns(&cols, source->width, newWidth,
+                                   (float)source->width / newWidth)) {
+        free(buffer);
+        freeImageRGBA(dest);
+        return NULL;
+    }
+
+    scaleY = (float)source->height / newHeight;
+
+    omp_set_num_threads(numThreads);
+
+    #pragma omp parallel
+    {
+        PixelRGBA *cache[2];
+        int cachedY[2] = {-1, -1};
+        int y;
+
+        cache[0] = buffer + (size_t)omp_get_thread_num() * 2 * source->width;
+        cache[1] = cache[0] + source->width;
+
+        /* Static: tiap thread dapat baris berurutan, cache tetap terpakai */
+        #pragma omp for schedule(static)
+        for (y = 0; y < newHeight; y++) {
+            resizeRowRGBA(source, &dest->data[y * newWidth], y, newWidth,
+                          scaleY, &cols, cache, cachedY);
+        }
+    }
+
+    freeColumns(&cols);
+    free(buffer);
+    return dest;
+}
+#endif
+
+/* ============================================================================
+ * CREATE TEST IMAGE
+ * ============================================================================ */
+
+Image* createTestImage(int size) {
+    Image *img;
+    int x, y;
+
+    img = createImage(size, size);
+    if (!img) return NULL;
+
+    /* Isi dengan gradient pattern */
+    for (y = 0; y < size; y++) {
+        for (x = 0; x < size; x++) {
+            float val = (float)((x + y) % 256);
+            Pixel p;
+            p.r = val;
+            p.g = val;
+            p.b = val;
+            setPixel(img, x, y, p);
+        }
+    }
+
+    return img;
+}
+
+/* Gradient RGBA: warna sama dengan createTestImage, alpha gradient vertikal */
+ImageRGBA* createTestImageRGBA(int size) {
+    ImageRGBA *img;
+    int x, y;
+
+    img = createImageRGBA(size, size);
+    if (!img) return NULL;
+
+    for (y = 0; y < size; y++) {
+        for (x = 0; x < size; x++) {
+            PixelRGBA *p = &img->data[y * size + x];
+            float val = (float)((x + y) % 256);
+            p->r = val;
+            p->g = val;
+            p->b = val;
+            p->a = (float)(y % 256);
+        }
+    }
+
+    return img;
+}
+
+/* ============================================================================
+ * AUTOTUNER (Backend Selector + Calibration Cache)
+ * ============================================================================
+ * Backend terbaik (serial / OpenMP / OpenMP tiled, jumlah thread, ukuran
+ * tile) tergantung ukuran image dan mesin. Autotuner mengukur semua
+ * kandidat pada grid ukuran, lalu menyimpan pemenangnya per bucket
+ * (src, dst) ke file kalibrasi. resizeAuto() memakai tabel tersebut.
+ *
+ * Bucket ukuran: floor(log4(width * height)), jadi 1 bucket = sisi 2x.
+ *
+ * Kandidat diurutkan dari yang paling sederhana (serial). Kandidat yang
+ * lebih kompleks hanya menang jika lebih cepat minimal CALIB_MIN_GAIN dari
+ * pemenang sementara; selisih lebih kecil dari itu dianggap noise.
+ *
+ * Format file (teks):
+ *   # bilinear calibration v1
+ *   threads <maxThreads>
+ *   <srcBucket> <dstBucket> <backend> <threads> <tileSize> <timeMs>
+ * ============================================================================ */
+
+#define CALIB_FILE          "bilinear_calib.txt"
+#define CALIB_NUM_BUCKETS   13
+#define CALIB_MAX_CANDIDATES 32
+#define CALIB_MIN_GAIN      0.07    /* Minimal 7% lebih cepat untuk menang */
+
+typedef enum {
+    BACKEND_SERIAL = 0,
+    BACKEND_OPENMP = 1,
+    BACKEND_OPENMP_TILED = 2
+} Backend;
+
+typedef struct {
+    Backend backend;
+    int threads;
+    int tileSize;
+} ResizeConfig;
+
+typedef struct {
+    int valid;
+    ResizeConfig config;
+    double timeMs;
+} CalibEntry;
+
+static CalibEntry calibTable[CALIB_NUM_BUCKETS][CALIB_NUM_BUCKETS];
+
+int sizeBucket(int width, int height) {
+    long pixels = (long)width * height;
+    int bucket = 0;
+
+    while (pixels >= 4 && bucket < CALIB_NUM_BUCKETS - 1) {
+        pixels >>= 2;
+        bucket++;
+    }
+    return bucket;
+}
+
+/* Jumlah core (tidak berubah oleh omp_set_num_threads) */
+int maxThreadsAvailable() {
+#ifdef USE_OPENMP
+    return omp_get_num_procs();
+#else
+    return 1;
+#endif
+}
+
+/**
+ * Daftar jumlah thread yang dicoba: 2, 4, 8, ... sampai jumlah core,
+ * ditambah jumlah core itu sendiri jika bukan pangkat 2. Tidak pernah
+ * melebihi jumlah core (oversubscription); kosong pada mesin 1 core.
+ */
+int threadCandidates(int *out, int maxOut) {
+    int maxThreads = maxThreadsAvailable();
+    int n = 0, t;
+
+    if (maxThreads < 2) return 0;
+    for (t = 2; t < maxThreads && n < maxOut; t *= 2) {
+        out[n++] = t;
+    }
+    if (n < maxOut) out[n++] = maxThreads;
+    return n;
+}
+
+const char* backendName(Backend backend) {
+    switch (backend) {
+        case BACKEND_OPENMP:       return "openmp";
+        case BACKEND_OPENMP_TILED: return "openmp-tiled";
+        default:                   return "serial";
+    }
+}
+
+void formatConfig(ResizeConfig cfg, char *buf, size_t size) {
+    if (cfg.backend == BACKEND_SERIAL) {
+        snprintf(buf, size, "serial");
+    } else if (cfg.backend == BACKEND_OPENMP) {
+        snprintf(buf, size, "openmp-%d", cfg.threads);
+    } else {
+        snprintf(buf, size, "openmp-%d/tile%d", cfg.threads, cfg.tileSize);
+    }
+}
+
+/* Jalankan resize dengan konfigurasi tertentu */
+Image* resizeWithConfig(const Image *source, int newWidth, int newHeight, ResizeConfig cfg) {
+#ifdef USE_OPENMP
+    if (cfg.backend == BACKEND_OPENMP) {
+        return resizeOpenMP(source, newWidth, newHeight, cfg.threads);
+    }
+    if (cfg.backend == BACKEND_OPENMP_TILED) {
+        return resizeOpenMPTiled(source, newWidth, newHeight, cfg.threads, cfg.tileSize);
+    }
+#endif
+    return resizeSerial(source, newWidth, newHeight);
+}
+
+/* Semua konfigurasi yang tersedia di build ini */
+int listCandidates(ResizeConfig *out, int maxOut) {
+    int n = 0;
+#ifdef USE_OPENMP
+    int threads[CALIB_MAX_CANDIDATES];
+    int tileSizes[] = {32, 128};
+    int numThreads, i, j;
+#endif
+
+    out[n].backend = BACKEND_SERIAL;
+    out[n].threads = 1;
+    out[n].tileSize = 0;
+    n++;
+
+#ifdef USE_OPENMP
+    numThreads = threadCandidates(threads, CALIB_MAX_CANDIDATES);
+    for (i = 0; i < numThreads && n < maxOut; i++) {
+        out[n].backend = BACKEND_OPENMP;
+        out[n].threads = threads[i];
+        out[n].tileSize = 0;
+        n++;
+
+        for (j = 0; j < 2 && n < maxOut; j++) {
+            out[n].backend = BACKEND_OPENMP_TILED;
+            out[n].threads = threads[i];
+            out[n].tileSize = tileSizes[j];
+            n++;
+        }
+    }
+#endif
+
+    return n;
+}
+
+static int compareTimes(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/* Waktu median (ms) dari beberapa kali pengulangan (minimal 7) */
+double measureConfig(const Image *source, int newWidth, int newHeight, ResizeConfig cfg) {
+    long dstPixels = (long)newWidth * newHeight;
+    int reps = (int)(4L * 1024 * 1024 / dstPixels);
+    double times[51];
+    int r;
+
+    if (reps < 7) reps = 7;
+    if (reps > 51) reps = 51;
+
+    for (r = 0; r < reps; r++) {
+        double start = getTimeMs();
+        Image *result = resizeWithConfig(source, newWidth, newHeight, cfg);
+
+        times[r] = getTimeMs() - start;
+        if (result) freeImage(result);
+    }
+
+    qsort(times, reps, sizeof(double), compareTimes);
+    return times[reps / 2];
+}
+
+/**
+ * Ukur semua kandidat pada grid ukuran dan simpan pemenang ke calibTable.
+ * Bucket yang tidak dikalibrasi memakai bucket terdekat (lihat lookupConfig).
+ */
+void runCalibration() {
+    int gridSizes[] = {32, 128, 512, 2048};
+    int numGrid = 4;
+    ResizeConfig candidates[CALIB_MAX_CANDIDATES];
+    int numCandidates, s, d, c;
+
+    numCandidates = listCandidates(candidates, CALIB_MAX_CANDIDATES);
+    memset(calibTable, 0, sizeof(calibTable));
+
+    printf("Calibrating %d configurations on %d sizes...\n",
+           numCandidates, numGrid * numGrid);
+
+    for (s = 0; s < numGrid; s++) {
+        Image *source = createTestImage(gridSizes[s]);
+        if (!source) continue;
+
+        for (d = 0; d < numGrid; d++) {
+            int dstSize = gridSizes[d];
+            CalibEntry *entry = &calibTable[sizeBucket(gridSizes[s], gridSizes[s])]
+                                           [sizeBucket(dstSize, dstSize)];
+            char name[64];
+
+            /*
+             * candidates[0] = serial; kandidat berikutnya harus menang jelas.
+             * Kemenangan dikonfirmasi dengan mengukur ulang pemenang
+             * sementara dan kandidat berurutan, supaya perubahan kecepatan
+             * mesin di antara 2 pengukuran tidak menentukan pemenang.
+             */
+            for (c = 0; c < numCandidates; c++) {
+                double ms = measureConfig(source, dstSize, dstSize, candidates[c]);
+
+                if (entry->valid && ms < entry->timeMs * (1.0 - CALIB_MIN_GAIN)) {
+                    entry->timeMs = measureConfig(source, dstSize, dstSize, entry->config);
+                    ms = measureConfig(source, dstSize, dstSize, candidates[c]);
+                }
+                if (!entry->valid || ms < entry->timeMs * (1.0 - CALIB_MIN_GAIN)) {
+                    entry->valid = 1;
+                    entry->config = candidates[c];
+                    entry->timeMs = ms;
+                }
+            }
+
+            formatConfig(entry->config, name, sizeof(name));
+            printf("  %4dx%-4d -> %4dx%-4d : %-20s %8.3f ms\n",
+                   gridSizes[s], gridSizes[s], dstSize, dstSize, name, entry->timeMs);
+        }
+
+        freeImage(source);
+    }
+}
+
+int saveCalibration(const char *path) {
+    FILE *f = fopen(path, "w");
+    int s, d;
+
+    if (!f) return 0;
+
+    fprintf(f, "# bilinear calibration v1\n");
+    fprintf(f, "threads %d\n", maxThreadsAvailable());
+    for (s = 0; s < CALIB_NUM_BUCKETS; s++) {
+        for (d = 0; d < CALIB_NUM_BUCKETS; d++) {
+            const CalibEntry *e = &calibTable[s][d];
+            if (!e->valid) continue;
+            fprintf(f, "%d %d %d %d %d %.4f\n", s, d, (int)e->config.backend,
+                    e->config.threads, e->config.tileSize, e->timeMs);
+        }
+    }
+
+    fclose(f);
+    return 1;
+}
+
+/**
+ * Baca file kalibrasi. File dari mesin dengan jumlah thread berbeda
+ * dianggap tidak valid (return 0), sehingga perlu kalibrasi ulang.
+ * Baris yang tidak konsisten (thread di luar 1..core, serial dengan
+ * thread != 1, tiled dengan tile < 1) dilewati.
+ */
+int loadCalibration(const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int threads = -1, loaded = 0;
+
+    if (!f) return 0;
+
+    memset(calibTable, 0, sizeof(calibTable));
+
+    while (fgets(line, sizeof(line), f)) {
+        int s, d, backend, nt, tile;
+        double ms;
+
+        if (line[0] == '#') continue;
+        if (sscanf(line, "threads %d", &threads) == 1) continue;
+        if (sscanf(line, "%d %d %d %d %d %lf", &s, &d, &backend, &nt, &tile, &ms) != 6) continue;
+        if (s < 0 || s >= CALIB_NUM_BUCKETS || d < 0 || d >= CALIB_NUM_BUCKETS) continue;
+        if (backend < BACKEND_SERIAL || backend > BACKEND_OPENMP_TILED) continue;
+        if (nt < 1 || nt > maxThreadsAvailable()) continue;
+        if (backend == BACKEND_SERIAL && nt != 1) continue;
+        if (backend == BACKEND_OPENMP_TILED && tile < 1) continue;
+
+        calibTable[s][d].valid = 1;
+        calibTable[s][d].config.backend = (Backend)backend;
+        calibTable[s][d].config.threads = nt;
+        calibTable[s][d].config.tileSize = tile;
+        calibTable[s][d].timeMs = ms;
+        loaded++;
+    }
+
+    fclose(f);
+
+    if (threads != maxThreadsAvailable()) {
+        memset(calibTable, 0, sizeof(calibTable));
+        return 0;
+    }
+    return loaded;
+}
+
+/**
+ * Konfigurasi untuk ukuran (src, dst): entry bucket yang sama, atau
+ * entry terkalibrasi terdekat. Tanpa kalibrasi: serial untuk output kecil,
+ * OpenMP dengan semua core untuk output besar.
+ */
+ResizeConfig lookupConfig(int srcWidth, int srcHeight, int dstWidth, int dstHeight) {
+    int sb = sizeBucket(srcWidth, srcHeight);
+    int db = sizeBucket(dstWidth, dstHeight);
+    int bestDist = -1, s, d;
+    ResizeConfig cfg;
+
+    for (s = 0; s < CALIB_NUM_BUCKETS; s++) {
+        for (d = 0; d < CALIB_NUM_BUCKETS; d++) {
+            int dist;
+            if (!calibTable[s][d].valid) continue;
+            dist = abs(s - sb) + abs(d - db);
+            if (bestDist < 0 || dist < bestDist) {
+                bestDist = dist;
+                cfg = calibTable[s][d].config;
+            }
+        }
+    }
+    if (bestDist >= 0) return cfg;
+
+    cfg.backend = BACKEND_SERIAL;
+    cfg.threads = 1;
+    cfg.tileSize = 0;
+#ifdef USE_OPENMP
+    if ((long)dstWidth * dstHeight >= 256L * 256 && maxThreadsAvailable() > 1) {
+        cfg.backend = BACKEND_OPENMP;
+        cfg.threads = maxThreadsAvailable();
+    }
+#endif
+    return cfg;
+}
+
+/* Resize dengan backend pilihan autotuner */
+Image* resizeAuto(const Image *source, int newWidth, int newHeight) {
+    ResizeConfig cfg = lookupConfig(source->width, source->height, newWidth, newHeight);
+    return resizeWithConfig(source, newWidth, newHeight, cfg);
+}
+
+/* ============================================================================
+ * VIRTUAL OUTPUT IMAGE (Tile-on-demand + LRU Cache)
+ * ============================================================================
+ * Untuk viewer map/zoom yang hanya meminta sebagian kecil tile dari output
+ * yang sangat besar. Output tidak pernah dialokasikan penuh: setiap tile
+ * VTILE_SIZE x VTILE_SIZE dihitung saat pertama kali diakses dan disimpan
+ * di cache LRU dengan batas memory.
+ *
+ * Thread-safety:
+ *   - Lookup/insert/evict dilindungi satu lock (omp_lock_t)
+ *   - Perhitungan tile dilakukan DI LUAR lock, sehingga thread lain tetap
+ *     bisa membaca tile yang sudah ada. Jika 2 thread menghitung tile yang
+ *     sama bersamaan, hasil kedua dibuang.
+ *   - Tile yang sedang dipakai (pinCount > 0) tidak akan di-evict.
+ * ============================================================================ */
+
+#define VTILE_SIZE 256
+
+typedef struct CachedTile {
+    int tx, ty;                     /* Koordinat tile */
+    Pixel *data;                    /* VTILE_SIZE x VTILE_SIZE pixel */
+    int pinCount;                   /* Jumlah reader yang sedang memakai */
+    struct CachedTile *prev, *next; /* List LRU (head = paling baru) */
+    struct CachedTile *hashNext;    /* Chain hash table */
+} CachedTile;
+
+typedef struct {
+    const Image *source;
+    int width, height;              /* Ukuran output virtual */
+    int tilesX, tilesY;
+    float scaleX, scaleY;
+
+    size_t maxTiles;                /* Batas memory dalam jumlah tile */
+    size_t numTiles;
+    CachedTile **buckets;
+    int numBuckets;                 /* Pangkat 2 */
+    CachedTile *head, *tail;
+
+    long hits, misses, evictions;
+
+#ifdef USE_OPENMP
+    omp_lock_t lock;
+#endif
+} VirtualImage;
+
+static void vimgLock(VirtualImage *vimg) {
+#ifdef USE_OPENMP
+    omp_set_lock(&vimg->lock);
+#else
+    (void)vimg;
+#endif
+}
+
+static void vimgUnlock(VirtualImage *vimg) {
+#ifdef USE_OPENMP
+    omp_unset_lock(&vimg->lock);
+#else
+    (void)vimg;
+#endif
+}
+
+/**
+ * Membuat virtual image width x height dari source.
+ * @param maxBytes - Batas memory cache (minimal 1 tile)
+ */
+VirtualImage* createVirtualImage(const Image *source, int width, int height, size_t maxBytes) {
+    VirtualImage *vimg = (VirtualImage*)calloc(1, sizeof(VirtualImage));
+    size_t tileBytes = (size_t)VTILE_SIZE * VTILE_SIZE * sizeof(Pixel);
+    if (!vimg) return NULL;
+
+    vimg->source = source;
+    vimg->width = width;
+    vimg->height = height;
+    vimg->tilesX = (width + VTILE_SIZE - 1) / VTILE_SIZE;
+    vimg->tilesY = (height + VTILE_SIZE - 1) / VTILE_SIZE;
+    vimg->scaleX = (float)source->width / width;
+    vimg->scaleY = (float)source->height / height;
+
+    vimg->maxTiles = maxBytes / tileBytes;
+    if (vimg->maxTiles < 1) vimg->maxTiles = 1;
+
+    vimg->numBuckets = 16;
+    while ((size_t)vimg->numBuckets < vimg->maxTiles * 2) vimg->numBuckets *= 2;
+    vimg->buckets = (CachedTile**)calloc(vimg->numBuckets, sizeof(CachedTile*));
+    if (!vimg->buckets) {
+        free(vimg);
+        return NULL;
+    }
+
+#ifdef USE_OPENMP
+    omp_init_lock(&vimg->lock);
+#endif
+
+    return vimg;
+}
+
+void freeVirtualImage(VirtualImage *vimg) {
+    CachedTile *tile, *next;
+
+    if (!vimg) return;
+
+    for (tile = vimg->head; tile; tile = next) {
+        next = tile->next;
+        free(tile->data);
+        free(tile);
+    }
+
+#ifdef USE_OPENMP
+    omp_destroy_lock(&vimg->lock);
+#endif
+
+    free(vimg->buckets);
+    free(vimg);
+}
+
+static int tileHash(const VirtualImage *vimg, int tx, int ty) {
+    return (ty * vimg->tilesX + tx) & (vimg->numBuckets - 1);
+}
+
+/* Cari tile di hash table (lock harus sudah dipegang) */
+static CachedTile* findTile(VirtualImage *vimg, int tx, int ty) {
+    CachedTile *tile = vimg->buckets[tileHash(vimg, tx, ty)];
+    while (tile && (tile->tx != tx || tile->ty != ty)) tile = tile->hashNext;
+    return tile;
+}
+
+static void lruUnlink(VirtualImage *vimg, CachedTile *tile) {
+    if (tile->prev) tile->prev->next = tile->next;
+    else vimg->head = tile->next;
+    if (tile->next) tile->next->prev = tile->prev;
+    else vimg->tail = tile->prev;
+    tile->prev = tile->next = NULL;
+}
+
+static void lruPushFront(VirtualImage *vimg, CachedTile *tile) {
+    tile->prev = NULL;
+    tile->next = vimg->head;
+    if (vimg->head) vimg->head->prev = tile;
+    vimg->head = tile;
+    if (!vimg->tail) vimg->tail = tile;
+}
+
+/* Buang tile LRU yang tidak di-pin sampai cache kembali di bawah batas */
+static void evictTiles(VirtualImage *vimg) {
+    CachedTile *tile = vimg->tail;
+
+    while (vimg->numTiles > vimg->maxTiles && tile) {
+        CachedTile *prev = tile->prev;
+
+        if (tile->pinCount == 0) {
+            CachedTile **link = &vimg->buckets[tileHash(vimg, tile->tx, tile->ty)];
+            while (*link != tile) link = &(*link)->hashNext;
+            *link = tile->hashNext;
+
+            lruUnlink(vimg, tile);
+            free(tile->data);
+            free(tile);
+            vimg->numTiles--;
+            vimg->evictions++;
+        }
+        tile = prev;
+    }
+}
+
+/* Hitung isi tile dengan kernel bilinear (mapping sama dengan resizeSerial) */
+static void computeTile(const VirtualImage *vimg, int tx, int ty, Pixel *out) {
+    int x0 = tx * VTILE_SIZE;
+    int y0 = ty * VTILE_SIZE;
+    int x1 = mini(x0 + VTILE_SIZE, vimg->width);
+    int y1 = mini(y0 + VTILE_SIZE, vimg->height);
+    int x, y;
+
+    for (y = y0; y < y1; y++) {
+        for (x = x0; x < x1; x++) {
+            float srcX = x * vimg->scaleX;
+            float srcY = y * vimg->scaleY;
+            out[(y - y0) * VTILE_SIZE + (x - x0)] = bilinearInterpolate(vimg->source, srcX, srcY);
+        }
+    }
+}
+
+/**
+ * Ambil tile (tx, ty), hitung jika belum ada di cache.
+ * Tile di-pin sampai virtualImageReleaseTile() dipanggil.
+ * Pixel (x, y) di dalam tile: tile->data[y * VTILE_SIZE + x]
+ * @return Tile, atau NULL jika koordinat di luar range / gagal alokasi
+ */
+CachedTile* virtualImageAcquireTile(VirtualImage *vimg, int tx, int ty) {
+    CachedTile *tile, *fresh;
+
+    if (tx < 0 || ty < 0 || tx >= vimg->tilesX || ty >= vimg->tilesY) return NULL;
+
+    /* Cache hit */
+    vimgLock(vimg);
+    tile = findTile(vimg, tx, ty);
+    if (tile) {
+        lruUnlink(vimg, tile);
+        lruPushFront(vimg, tile);
+        tile->pinCount++;
+        vimg->hits++;
+        vimgUnlock(vimg);
+        return tile;
+    }
+    vimgUnlock(vimg);
+
+    /* Cache miss: hitung di luar lock */
+    fresh = (CachedTile*)calloc(1, sizeof(CachedTile));
+    if (!fresh) return NULL;
+    fresh->data = (Pixel*)calloc((size_t)VTILE_SIZE * VTILE_SIZE, sizeof(Pixel));
+    if (!fresh->data) {
+        free(fresh);
+        return NULL;
+    }
+    fresh->tx = tx;
+    fresh->ty = ty;
+    computeTile(vimg, tx, ty, fresh->data);
+
+    vimgLock(vimg);
+    tile = findTile(vimg, tx, ty);
+    if (tile) {
+        /* Thread lain sudah memasukkan tile yang sama */
+        lruUnlink(vimg, tile);
+        lruPushFront(vimg, tile);
+        vimg->hits++;
+    } else {
+        int h = tileHash(vimg, tx, ty);
+        tile = fresh;
+        fresh = NULL;
+        tile->hashNext = vimg->buckets[h];
+        vimg->buckets[h] = tile;
+        lruPushFront(vimg, tile);
+        vimg->numTiles++;
+        vimg->misses++;
+    }
+    tile->pinCount++;
+    evictTiles(vimg);
+    vimgUnlock(vimg);
+
+    if (fresh) {
+        free(fresh->data);
+        free(fresh);
+    }
+    return tile;
+}
+
+void virtualImageReleaseTile(VirtualImage *vimg, CachedTile *tile) {
+    if (!tile) return;
+
+    vimgLock(vimg);
+    tile->pinCount--;
+    evictTiles(vimg);
+    vimgUnlock(vimg);
+}
+
+/* Ambil 1 pixel output (x, y) */
+Pixel virtualImageGetPixel(VirtualImage *vimg, int x, int y) {
+    CachedTile *tile = virtualImageAcquireTile(vimg, x / VTILE_SIZE, y / VTILE_SIZE);
+    Pixel p = {0.0f, 0.0f, 0.0f};
+
+    if (tile) {
+        p = tile->data[(y % VTILE_SIZE) * VTILE_SIZE + (x % VTILE_SIZE)];
+        virtualImageReleaseTile(vimg, tile);
+    }
+    return p;
+}
+
+/**
+ * Prefetch tile di sekitar (tx, ty) dalam jarak radius, supaya pan ke tile
+ * tetangga langsung mendapat cache hit.
+ *
+ * Asynchronous: setiap tile yang belum ada di cache menjadi 1 OpenMP task,
+ * lalu fungsi langsung kembali. Panggil dari dalam parallel region (mis.
+ * omp single pada team yang persisten) supaya thread lain mengerjakan task
+ * di luar critical path; task selesai paling lambat di barrier/taskwait
+ * berikutnya, dan harus selesai sebelum freeVirtualImage(). Di luar
+ * parallel region, pada team 1 thread, atau tanpa OpenMP, prefetch berjalan
+ * synchronous (tanpa thread lain, task yang ditunda baru jalan di barrier
+ * akhir, saat tile-nya sudah tidak dibutuhkan).
+ */
+void virtualImagePrefetch(VirtualImage *vimg, int tx, int ty, int radius) {
+    int side = 2 * radius + 1;
+    int i;
+
+    for (i = 0; i < side * side; i++) {
+        int nx = tx + (i % side) - radius;
+        int ny = ty + (i / side) - radius;
+        int cached;
+
+        if (nx == tx && ny == ty) continue;
+        if (nx < 0 || ny < 0 || nx >= vimg->tilesX || ny >= vimg->tilesY) continue;
+
+        vimgLock(vimg);
+        cached = findTile(vimg, nx, ny) != NULL;
+        vimgUnlock(vimg);
+        if (cached) continue;
+
+#ifdef USE_OPENMP
+        #pragma omp task firstprivate(nx, ny) if(omp_get_num_threads() > 1)
+#endif
+        {
+            CachedTile *tile = virtualImageAcquireTile(vimg, nx, ny);
+            virtualImageReleaseTile(vimg, tile);
+        }
+    }
+}
+
+/* ============================================================================
+ * BENCHMARK FUNCTION
+ * ============================================================================ */
+
+void runBenchmark() {
+    int testSizes[] = {512, 1024, 2048};
+    int numTests = 3;
+    int targetSize = 2048;
+    int t;
+
+    printf("\n");
+    printf("========================================================================\n");
+    printf("      BENCHMARK: BILINEAR INTERPOLATION (Pure C with OpenMP)\n");
+    printf("========================================================================\n\n");
+
+    for (t = 0; t < numTests; t++) {
+        int size = testSizes[t];
+        Image *testImg;
+        Image *resultSerial;
+        double startTime, endTime;
+        double timeSerial;
+
+        printf("Test: Resize %dx%d -> %dx%d\n", size, size, targetSize, targetSize);
+        printf("------------------------------------------------------------------------\n");
+
+        /* Create test image */
+        testImg = createTestImage(size);
+        if (!testImg) {
+            printf("Error: Failed to create test image\n");
+            continue;
+        }
+
+        /* BENCHMARK SERIAL */
+        startTime = getTimeMs();
+        resultSerial = resizeSerial(testImg, targetSize, targetSize);
+        endTime = getTimeMs();
+        timeSerial = endTime - startTime;
+
+        printf("  [SERIAL]       Time: %7.0f ms\n", timeSerial);
+
+        if (resultSerial) freeImage(resultSerial);
+
+        /* BENCHMARK LINEAR LIGHT (overhead vs gamma-naive serial) */
+        {
+            Image *resultLinear;
+            double timeLinear;
+
+            initSrgbLut();
+
+            startTime = getTimeMs();
+            resultLinear = resizeSerialLinear(testImg, targetSize, targetSize);
+            endTime = getTimeMs();
+            timeLinear = endTime - startTime;
+
+            printf("  [LINEAR-LUT]   Time: %7.0f ms  |  Overhead: %+.0f%%\n",
+                   timeLinear, (timeLinear / timeSerial - 1.0) * 100.0);
+
+            if (resultLinear) freeImage(resultLinear);
+        }
+
+        /* BENCHMARK RGBA (premultiplied, single pass) */
+        {
+            ImageRGBA *testRgba = createTestImageRGBA(size);
+            ImageRGBA *resultRgba;
+            double timeRgba;
+
+            if (testRgba) {
+                startTime = getTimeMs();
+                resultRgba = resizeSerialRGBA(testRgba, targetSize, targetSize);
+                endTime = getTimeMs();
+                timeRgba = endTime - startTime;
+
+                printf("  [RGBA-PREMUL]  Time: %7.0f ms  |  vs RGB: %.2fx\n",
+                       timeRgba, timeSerial / timeRgba);
+
+                freeImageRGBA(resultRgba);
+                freeImageRGBA(testRgba);
+            }
+        }
+
+        /* BENCHMARK OPENMP */
+#ifdef USE_OPENMP
+        {
+            int threadCounts[CALIB_MAX_CANDIDATES];
+            int numThreadTests = threadCandidates(threadCounts, CALIB_MAX_CANDIDATES);
+            int i;
+
+            if (numThreadTests == 0) {
+                printf("  [OpenMP]       Skipped (1 core, no parallel speedup possible)\n");
+            }
+
+            for (i = 0; i < numThreadTests; i++) {
+                int threads = threadCounts[i];
+                Image *resultOmp;
+                double timeOmp, speedup;
+
+                startTime = getTimeMs();
+                resultOmp = resizeOpenMP(testImg, targetSize, targetSize, threads);
+                endTime = getTimeMs();
+                timeOmp = endTime - startTime;
+
+                speedup = timeSerial / timeOmp;
+                printf("  [OpenMP-%d]     Time: %7.0f ms  |  Speedup: %.2fx\n",
+                       threads, timeOmp, speedup);
+
+                if (resultOmp) freeImage(resultOmp);
+            }
+        }
+#else
+        printf("  [OpenMP]       Not compiled (compile with -fopenmp -DUSE_OPENMP)\n");
+#endif
+
+        /* BENCHMARK AUTO (backend pilihan autotuner) */
+        {
+            ResizeConfig cfg = lookupConfig(size, size, targetSize, targetSize);
+            Image *resultAuto;
+            double timeAuto;
+            char name[64];
+
+            startTime = getTimeMs();
+            resultAuto = resizeAuto(testImg, targetSize, targetSize);
+            endTime = getTimeMs();
+            timeAuto = endTime - startTime;
+
+            formatConfig(cfg, name, sizeof(name));
+            printf("  [AUTO]         Time: %7.0f ms  |  Speedup: %.2fx  (%s)\n",
+                   timeAuto, timeSerial / timeAuto, name);
+
+            if (resultAuto) freeImage(resultAuto);
+        }
+
+        printf("\n");
+        freeImage(testImg);
+    }
+
+    printf("========================================================================\n");
+}
+
+/* ============================================================================
+ * BENCHMARK TILE VIEWER
+ * ============================================================================
+ * Simulasi viewer: viewport 4x3 tile yang di-pan ke kanan 1 tile per frame
+ * di atas output virtual 16384x16384 (versi penuh butuh ~3 GB).
+ * ============================================================================ */
+
+void runTileViewerBenchmark() {
+    int sourceSize = 2048;
+    int virtualSize = 16384;
+    int viewW = 4, viewH = 3, numFrames = 16;
+    size_t cacheBytes = (size_t)32 * VTILE_SIZE * VTILE_SIZE * sizeof(Pixel);
+    double fullBytes = (double)virtualSize * virtualSize * sizeof(Pixel);
+    Image *source;
+    VirtualImage *vimg;
+    double startTime, elapsed, computed;
+    double frameTotal = 0.0, frameMax = 0.0, prefetchIssue = 0.0;
+    int asyncPrefetch = 0;
+
+    printf("\n");
+    printf("========================================================================\n");
+    printf("      BENCHMARK: TILE-ON-DEMAND VIRTUAL IMAGE (LRU cache)\n");
+    printf("========================================================================\n\n");
+
+    source = createTestImage(sourceSize);
+    if (!source) {
+        printf("Error: Failed to create test image\n");
+        return;
+    }
+
+    vimg = createVirtualImage(source, virtualSize, virtualSize, cacheBytes);
+    if (!vimg) {
+        printf("Error: Failed to create virtual image\n");
+        freeImage(source);
+        return;
+    }
+
+    printf("Virtual: %dx%d from %dx%d, viewport %dx%d tiles, %d frames\n",
+           virtualSize, virtualSize, sourceSize, sourceSize, viewW, viewH, numFrames);
+    printf("------------------------------------------------------------------------\n");
+
+    /*
+     * Team persisten: thread "viewer" (single) membuat task untuk tile
+     * viewport dan menunggu hanya task tersebut (taskgroup) = latency frame.
+     * Task prefetch tidak ditunggu; thread lain mengerjakannya di antara
+     * frame, dan sisanya selesai di barrier akhir region.
+     */
+#ifdef USE_OPENMP
+    omp_set_num_threads(maxThreadsAvailable());
+#endif
+
+    startTime = getTimeMs();
+#ifdef USE_OPENMP
+    #pragma omp parallel
+    #pragma omp single
+#endif
+    {
+        int frame, i;
+
+#ifdef USE_OPENMP
+        asyncPrefetch = omp_get_num_threads() > 1;
+#endif
+
+        for (frame = 0; frame < numFrames; frame++) {
+            int originX = 8 + frame, originY = 8;
+            double frameStart = getTimeMs(), frameMs, issueStart;
+
+#ifdef USE_OPENMP
+            #pragma omp taskgroup
+#endif
+            {
+                for (i = 0; i < viewW * viewH; i++) {
+#ifdef USE_OPENMP
+                    #pragma omp task firstprivate(i)
+#endif
+                    {
+                        CachedTile *tile = virtualImageAcquireTile(vimg, originX + i % viewW,
+                                                                   originY + i / viewW);
+                        virtualImageReleaseTile(vimg, tile);
+                    }
+                }
+            }
+
+            frameMs = getTimeMs() - frameStart;
+            frameTotal += frameMs;
+            if (frameMs > frameMax) frameMax = frameMs;
+
+            /* Prefetch tetangga dari tile paling kanan (arah pan) */
+            issueStart = getTimeMs();
+            virtualImagePrefetch(vimg, originX + viewW - 1, originY + viewH / 2, 1);
+            prefetchIssue += getTimeMs() - issueStart;
+        }
+    }
+    elapsed = getTimeMs() - startTime;
+
+    computed = (double)vimg->misses * VTILE_SIZE * VTILE_SIZE;
+    printf("  [FRAME]        Avg: %7.1f ms  |  Max: %.1f ms  (viewport only)\n",
+           frameTotal / numFrames, frameMax);
+    printf("  [PREFETCH]     Issue: %5.2f ms total  (%s)\n", prefetchIssue,
+           asyncPrefetch ? "async, off the frame path" : "synchronous, 1 thread");
+    printf("  [TILES]        Time: %7.0f ms  |  Computed: %ld tiles, Hits: %ld, Evicted: %ld\n",
+           elapsed, vimg->misses, vimg->hits, vimg->evictions);
+    printf("  [MEMORY]       Cache: %.0f MB (max)  |  Full output: %.0f MB\n",
+           (double)vimg->maxTiles * VTILE_SIZE * VTILE_SIZE * sizeof(Pixel) / (1024.0 * 1024.0),
+           fullBytes / (1024.0 * 1024.0));
+    printf("  [WORK]         Pixels computed: %.2f%% of full resize\n",
+           computed / ((double)virtualSize * virtualSize) * 100.0);
+
+    freeVirtualImage(vimg);
+    freeImage(source);
+
+    printf("\n========================================================================\n");
+}
+
+/* ============================================================================
+ * PRINT CONCEPT
+ * ============================================================================ */
+
+void printConcept() {
+    printf("\n");
+    printf("========================================================================\n");
     printf("                      ANALISIS KONSEP\n");
     printf("========================================================================\n\n");
 
@@ -321,6 +1911,15 @@ void printConcept() {
     printf("   - [NOT COMPILED] Compile dengan -fopenmp -DUSE_OPENMP\n\n");
 #endif
 
+    printf("3. LINEAR LIGHT (sRGB-correct)\n");
+    printf("   - Decode sRGB -> linear saat load, encode kembali saat store\n");
+    printf("   - Konversi lewat lookup table 4096 entry, bukan powf()\n");
+    printf("   - Tetap satu pass: tidak ada image perantara\n\n");
+
+    printf("4. RGBA (premultiplied alpha)\n");
+    printf("   - Baris sumber di-premultiply sekali (cache 2 baris), unpremultiply saat store\n");
+    printf("   - 1 pixel = 16 byte = 1 register SSE\n\n");
+
     printf("Expected Speedup:\n");
     printf("   - Ideal: S = P (P = jumlah cores)\n");
     printf("   - Real: S < P (karena overhead & Amdahl's law)\n");
@@ -330,9 +1929,24 @@ void printConcept() {
 
 /* ============================================================================
  * MAIN
+ * ============================================================================
+ * Define BILINEAR_NO_MAIN untuk memakai file ini sebagai library
+ * (mis. bilinear_daemon.c).
  * ============================================================================ */
 
-int main() {
+#ifndef BILINEAR_NO_MAIN
+int main(int argc, char **argv) {
+    /* Mode kalibrasi: ukur semua backend lalu simpan ke file */
+    if (argc > 1 && strcmp(argv[1], "--calibrate") == 0) {
+        runCalibration();
+        if (!saveCalibration(CALIB_FILE)) {
+            printf("Error: Failed to write %s\n", CALIB_FILE);
+            return 1;
+        }
+        printf("Calibration saved to %s\n", CALIB_FILE);
+        return 0;
+    }
+
     printf("\n");
     printf("╔═══════════════════════════════════════════════════════════════╗\n");
     printf("║     BILINEAR INTERPOLATION: SERIAL vs PARALLEL (C + OpenMP)  ║\n");
@@ -351,7 +1965,15 @@ int main() {
     printf("  OpenMP:   DISABLED (compile with -fopenmp -DUSE_OPENMP)\n");
 #endif
 
+    if (loadCalibration(CALIB_FILE)) {
+        printf("  Autotune: %s\n", CALIB_FILE);
+    } else {
+        printf("  Autotune: default heuristic (run with --calibrate)\n");
+    }
+
     runBenchmark();
+    runTileViewerBenchmark();
 
     return 0;
 }
+#endif /* BILINEAR_NO_MAIN */
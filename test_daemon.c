@@ -0,0 +1,240 @@
+/**
+ * ============================================================================
+ *              REGRESSION SUITE: BILINEAR DAEMON
+ * ============================================================================
+ * Menjalankan ./bilinear_daemon pada socket sementara, lalu memeriksa:
+ *   - hasil request valid sama dengan resizeSerial()
+ *   - memfd tanpa seal ditolak (BILINEAR_ERR_BADREQ)
+ *   - memfd yang di-shrink segera setelah request dikirim tidak membuat
+ *     daemon crash (SIGBUS)
+ *   - buffer dari bilinearBufferCreate() tidak bisa di-shrink
+ *   - request di atas budget per-request ditolak (BILINEAR_ERR_BADREQ)
+ *   - request yang tidak muat di budget batch mendapat BILINEAR_ERR_NOMEM
+ *     dan berhasil saat diulang
+ *   - socket dibuat dengan mode 0600
+ *
+ * Compile:
+ *   gcc -o test_daemon test_daemon.c bilinear_client.c -std=c99 -O3 -lm
+ *
+ * Run (bilinear_daemon harus sudah di-compile):
+ *   ./test_daemon
+ * ============================================================================
+ */
+
+#define _GNU_SOURCE
+#define BILINEAR_NO_MAIN
+#include "bilinear_openmp.c"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "bilinear_client.h"
+
+#define TEST_SOCKET "/tmp/bilinear_test_daemon.sock"
+#define TEST_SRC    64
+#define TEST_DST    97
+
+/*
+ * Budget kecil supaya batas bisa diuji tanpa alokasi besar: 1 request
+ * maksimal 100k pixel, 1 batch maksimal 150k pixel. Window panjang supaya
+ * dua request BUDGET_DST yang dikirim berurutan masuk batch yang sama.
+ */
+#define TEST_REQUEST_MPIX "0.1"
+#define TEST_BATCH_MPIX   "0.15"
+#define TEST_WINDOW_US    "100000"
+#define BUDGET_DST        300      /* 90k pixel: muat 1, tidak muat 2 */
+#define OVERSIZE_DST      400      /* 160k pixel > budget request */
+
+static int failures = 0;
+
+static void report(int ok, const char *name) {
+    printf("  [%s] %s\n", ok ? "PASS" : "FAIL", name);
+    if (!ok) failures++;
+}
+
+static pid_t startDaemon() {
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        int devnull = open("/dev/null", O_WRONLY);
+        if (devnull >= 0) dup2(devnull, STDOUT_FILENO);
+        execl("./bilinear_daemon", "bilinear_daemon", "-s", TEST_SOCKET,
+              "-r", TEST_REQUEST_MPIX, "-b", TEST_BATCH_MPIX, "-w", TEST_WINDOW_US, (char*)NULL);
+        _exit(127);
+    }
+    return pid;
+}
+
+/* Tunggu sampai socket menerima koneksi (maks ~2 detik) */
+static int connectRetry(BilinearClient *client) {
+    int i;
+
+    for (i = 0; i < 200; i++) {
+        if (bilinearClientConnect(client, TEST_SOCKET) == BILINEAR_OK) return 1;
+        usleep(10000);
+    }
+    return 0;
+}
+
+/* Kirim request mentah (source TEST_SRC) dengan fd apa pun */
+static int sendRequest(BilinearClient *client, int fd, int dst) {
+    BilinearRequest req;
+
+    req.magic = BILINEAR_MAGIC;
+    req.requestId = client->nextId++;
+    req.srcWidth = TEST_SRC;
+    req.srcHeight = TEST_SRC;
+    req.dstWidth = (uint32_t)dst;
+    req.dstHeight = (uint32_t)dst;
+
+    return bilinearSendMsg(client->sock, &req, sizeof(req), fd) < 0 ? BILINEAR_ERR_IO : BILINEAR_OK;
+}
+
+/* Terima reply, kembalikan statusnya */
+static int recvStatus(BilinearClient *client) {
+    BilinearReply reply;
+    int outFd;
+
+    if (bilinearRecvMsg(client->sock, &reply, sizeof(reply), &outFd) != (long)sizeof(reply)) {
+        return BILINEAR_ERR_IO;
+    }
+    if (outFd >= 0) close(outFd);
+    return reply.status;
+}
+
+static int rawRequest(BilinearClient *client, int fd, int dst, int shrinkAfterSend) {
+    if (sendRequest(client, fd, dst) != BILINEAR_OK) return BILINEAR_ERR_IO;
+    if (shrinkAfterSend && ftruncate(fd, 0) < 0) return BILINEAR_ERR_IO;
+    return recvStatus(client);
+}
+
+static int createUnsealed() {
+    int fd = memfd_create("unsealed", MFD_CLOEXEC);
+    size_t size = (size_t)TEST_SRC * TEST_SRC * sizeof(BilinearPixel);
+
+    if (fd >= 0 && ftruncate(fd, (off_t)size) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * Dua client mengirim request BUDGET_DST dalam window yang sama: hanya satu
+ * yang muat di budget batch, yang lain mendapat NOMEM lalu berhasil saat
+ * diulang di batch berikutnya.
+ */
+static int batchBudgetEnforced(const BilinearBuffer *in) {
+    BilinearClient a, b;
+    int statusA, statusB, retry, ok;
+
+    if (!connectRetry(&a)) return 0;
+    if (!connectRetry(&b)) {
+        bilinearClientClose(&a);
+        return 0;
+    }
+
+    sendRequest(&a, in->fd, BUDGET_DST);
+    sendRequest(&b, in->fd, BUDGET_DST);
+    statusA = recvStatus(&a);
+    statusB = recvStatus(&b);
+
+    ok = (statusA == BILINEAR_OK && statusB == BILINEAR_ERR_NOMEM) ||
+         (statusA == BILINEAR_ERR_NOMEM && statusB == BILINEAR_OK);
+
+    retry = rawRequest(statusA == BILINEAR_OK ? &b : &a, in->fd, BUDGET_DST, 0);
+    if (!ok) printf("    status %d / %d\n", statusA, statusB);
+
+    bilinearClientClose(&b);
+    bilinearClientClose(&a);
+    return ok && retry == BILINEAR_OK;
+}
+
+/* Request valid lewat client library, bandingkan dengan resizeSerial() */
+static int validRequestMatches(BilinearClient *client, const Image *src) {
+    BilinearBuffer in, out;
+    Image *ref;
+    int ok;
+
+    if (bilinearBufferCreate(&in, TEST_SRC, TEST_SRC) != BILINEAR_OK) return 0;
+    memcpy(in.data, src->data, in.size);
+
+    if (bilinearClientResize(client, &in, TEST_DST, TEST_DST, &out) != BILINEAR_OK) {
+        bilinearBufferFree(&in);
+        return 0;
+    }
+
+    ref = resizeSerial(src, TEST_DST, TEST_DST);
+    ok = ref && memcmp(ref->data, out.data, out.size) == 0;
+
+    freeImage(ref);
+    bilinearBufferFree(&out);
+    bilinearBufferFree(&in);
+    return ok;
+}
+
+int main() {
+    BilinearClient client;
+    BilinearBuffer sealed;
+    struct stat st;
+    Image *src = createTestImage(TEST_SRC);
+    pid_t pid;
+    int status, fd;
+
+    printf("\n");
+    printf("========================================================================\n");
+    printf("      REGRESSION: BILINEAR DAEMON (%s)\n", TEST_SOCKET);
+    printf("========================================================================\n\n");
+
+    pid = startDaemon();
+    if (pid < 0 || !src || !connectRetry(&client)) {
+        printf("Error: Failed to start ./bilinear_daemon\n");
+        if (pid > 0) kill(pid, SIGKILL);
+        return 1;
+    }
+
+    report(validRequestMatches(&client, src), "valid request matches resizeSerial");
+
+    fd = createUnsealed();
+    report(fd >= 0 && rawRequest(&client, fd, TEST_DST, 0) == BILINEAR_ERR_BADREQ,
+           "unsealed memfd rejected");
+    if (fd >= 0) close(fd);
+
+    fd = createUnsealed();
+    report(fd >= 0 && rawRequest(&client, fd, TEST_DST, 1) == BILINEAR_ERR_BADREQ,
+           "memfd shrunk after send rejected");
+    if (fd >= 0) close(fd);
+
+    if (bilinearBufferCreate(&sealed, TEST_SRC, TEST_SRC) == BILINEAR_OK) {
+        report(ftruncate(sealed.fd, 0) < 0 && errno == EPERM,
+               "client buffer cannot be shrunk");
+        report(rawRequest(&client, sealed.fd, OVERSIZE_DST, 0) == BILINEAR_ERR_BADREQ,
+               "request over pixel budget rejected");
+        report(batchBudgetEnforced(&sealed), "batch over pixel budget gets NOMEM, retry succeeds");
+        bilinearBufferFree(&sealed);
+    } else {
+        report(0, "client buffer cannot be shrunk");
+    }
+
+    report(stat(TEST_SOCKET, &st) == 0 && (st.st_mode & 0777) == 0600,
+           "socket mode is 0600");
+
+    report(validRequestMatches(&client, src), "daemon still serving");
+    report(waitpid(pid, &status, WNOHANG) == 0, "daemon still alive");
+
+    bilinearClientClose(&client);
+    kill(pid, SIGTERM);
+    waitpid(pid, &status, 0);
+    report(WIFEXITED(status) && WEXITSTATUS(status) == 0, "daemon clean shutdown");
+
+    freeImage(src);
+
+    printf("\nbilinear_daemon: %d failure(s)\n", failures);
+    printf("========================================================================\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,919 @@
+/**
+ * ============================================================================
+ *              REGRESSION SUITE: AKURASI & PERFORMA
+ * ============================================================================
+ * Menjalankan setiap backend resize terhadap implementasi referensi
+ * (double precision, semantik sampling yang sama dengan kernel) pada
+ * edge case (RGB dan RGBA premultiplied), lalu memeriksa max absolute error. Dengan --perf, throughput
+ * setiap backend relatif terhadap serial (run yang sama) dibandingkan dengan
+ * baseline tersimpan.
+ *
+ * File ini meng-include salah satu implementasi sebagai library:
+ *   default      : bilinear_openmp.c
+ *   -DTEST_LEGACY: bilinear.c
+ *
+ * Compile:
+ *   gcc -o test_regression_omp test_regression.c -std=c99 -O3 -fopenmp -DUSE_OPENMP -lm
+ *   gcc -o test_regression_legacy test_regression.c -std=c99 -O3 -fopenmp -DUSE_OPENMP \
+ *       -DTEST_LEGACY -lm
+ *
+ * Run:
+ *   ./test_regression_omp                        (akurasi)
+ *   ./test_regression_omp --perf [--tolerance t] [--absolute]
+ *                                                (performa vs baseline)
+ *   ./test_regression_omp --update-baseline      (simpan baseline baru)
+ * ============================================================================
+ */
+
+#define BILINEAR_NO_MAIN
+
+#include <string.h>
+
+#ifdef TEST_LEGACY
+#include "bilinear.c"
+#define createImage buatImage
+#define freeImage   hapusImage
+#define SUITE_NAME  "bilinear.c"
+#else
+#include "bilinear_openmp.c"
+#define SUITE_NAME  "bilinear_openmp.c"
+#endif
+
+#define PERF_BASELINE_FILE  "perf_baseline.txt"
+#define PERF_TOLERANCE      0.30    /* Boleh 30% lebih lambat dari baseline */
+#define PERF_MAX_ENTRIES    128
+#define PERF_MIN_REPS       21      /* Median dari minimal 21 run ... */
+#define PERF_MIN_TIME_MS    500.0   /* ... dan minimal 0.5 detik per backend */
+#define PERF_MAX_REPS       256
+
+/* Error maksimum (skala 0-255) terhadap referensi */
+#define TOL_GAMMA   0.02    /* Float vs double */
+#define TOL_LINEAR  0.10    /* Lookup table sRGB vs powf */
+#define TOL_RGBA    0.02    /* Float (rcp + Newton) vs double */
+
+/* ============================================================================
+ * BACKEND YANG DIUJI
+ * ============================================================================ */
+
+typedef Image* (*ResizeFn)(const Image *source, int newWidth, int newHeight);
+
+typedef struct {
+    const char *name;
+    ResizeFn fn;
+    int linear;     /* 1 = interpolasi di linear light */
+} TestBackend;
+
+#ifdef USE_OPENMP
+static Image* resizeOmp1(const Image *s, int w, int h) { return resizeOpenMP(s, w, h, 1); }
+static Image* resizeOmp2(const Image *s, int w, int h) { return resizeOpenMP(s, w, h, 2); }
+static Image* resizeOmp4(const Image *s, int w, int h) { return resizeOpenMP(s, w, h, 4); }
+#endif
+
+#ifndef TEST_LEGACY
+#ifdef USE_OPENMP
+static Image* resizeTiled7(const Image *s, int w, int h) { return resizeOpenMPTiled(s, w, h, 4, 7); }
+static Image* resizeTiled64(const Image *s, int w, int h) { return resizeOpenMPTiled(s, w, h, 4, 64); }
+static Image* resizeOmpLinear4(const Image *s, int w, int h) { return resizeOpenMPLinear(s, w, h, 4); }
+#endif
+
+/*
+ * Resize lewat API per-pixel bilinearInterpolateLinear(). Di tabel backend
+ * diletakkan sebelum linear-serial, sehingga pada case pertama tabel sRGB
+ * belum dibangun (memeriksa inisialisasi otomatis).
+ */
+static Image* resizeLinearPixel(const Image *s, int w, int h) {
+    Image *dest = createImage(w, h);
+    float scaleX = (float)s->width / w, scaleY = (float)s->height / h;
+    int x, y;
+
+    if (!dest) return NULL;
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            setPixel(dest, x, y, bilinearInterpolateLinear(s, x * scaleX, y * scaleY));
+        }
+    }
+    return dest;
+}
+
+/* Rakit output penuh dari VirtualImage dengan cache 2 tile (memaksa eviction) */
+static Image* resizeVirtual(const Image *s, int w, int h) {
+    size_t tileBytes = (size_t)VTILE_SIZE * VTILE_SIZE * sizeof(Pixel);
+    VirtualImage *vimg = createVirtualImage(s, w, h, 2 * tileBytes);
+    Image *dest = createImage(w, h);
+    int tx, ty, x, y;
+
+    if (!vimg || !dest) {
+        freeVirtualImage(vimg);
+        freeImage(dest);
+        return NULL;
+    }
+
+    for (ty = 0; ty < vimg->tilesY; ty++) {
+        for (tx = 0; tx < vimg->tilesX; tx++) {
+            CachedTile *tile = virtualImageAcquireTile(vimg, tx, ty);
+            if (!tile) continue;
+
+            for (y = ty * VTILE_SIZE; y < mini((ty + 1) * VTILE_SIZE, h); y++) {
+                for (x = tx * VTILE_SIZE; x < mini((tx + 1) * VTILE_SIZE, w); x++) {
+                    setPixel(dest, x, y, tile->data[(y % VTILE_SIZE) * VTILE_SIZE + x % VTILE_SIZE]);
+                }
+            }
+            virtualImageReleaseTile(vimg, tile);
+        }
+    }
+
+    freeVirtualImage(vimg);
+    return dest;
+}
+#endif
+
+static const TestBackend backends[] = {
+    {"serial",        resizeSerial,       0},
+#ifdef USE_OPENMP
+    {"openmp-1",      resizeOmp1,         0},
+    {"openmp-2",      resizeOmp2,         0},
+    {"openmp-4",      resizeOmp4,         0},
+#endif
+#ifndef TEST_LEGACY
+#ifdef USE_OPENMP
+    {"tiled-4/7",     resizeTiled7,       0},
+    {"tiled-4/64",    resizeTiled64,      0},
+#endif
+    {"auto",          resizeAuto,         0},
+    {"virtual",       resizeVirtual,      0},
+    {"linear-pixel",  resizeLinearPixel,  1},
+    {"linear-serial", resizeSerialLinear, 1},
+#ifdef USE_OPENMP
+    {"linear-omp-4",  resizeOmpLinear4,   1},
+#endif
+#endif
+};
+
+#define NUM_BACKENDS ((int)(sizeof(backends) / sizeof(backends[0])))
+
+#ifndef TEST_LEGACY
+typedef ImageRGBA* (*ResizeRGBAFn)(const ImageRGBA *source, int newWidth, int newHeight);
+
+typedef struct {
+    const char *name;
+    ResizeRGBAFn fn;
+} TestBackendRGBA;
+
+#ifdef USE_OPENMP
+static ImageRGBA* resizeOmpRGBA4(const ImageRGBA *s, int w, int h) { return resizeOpenMPRGBA(s, w, h, 4); }
+#endif
+
+static const TestBackendRGBA backendsRGBA[] = {
+    {"rgba-serial",   resizeSerialRGBA},
+#ifdef USE_OPENMP
+    {"rgba-omp-4",    resizeOmpRGBA4},
+#endif
+};
+
+#define NUM_BACKENDS_RGBA ((int)(sizeof(backendsRGBA) / sizeof(backendsRGBA[0])))
+#else
+#define NUM_BACKENDS_RGBA 0
+#endif
+
+/* ============================================================================
+ * IMPLEMENTASI REFERENSI (double precision)
+ * ============================================================================
+ * Semantik sama dengan kernel: srcX = x * (srcW / dstW), clamp ke
+ * [0, W - 1.001] (minimal 0), 4 tetangga, bobot bilinear. Koordinat
+ * dihitung dalam float seperti kernel; hanya aritmetika pixel yang double.
+ * ============================================================================ */
+
+static double refDecode(double v) {
+    v /= 255.0;
+    return (v <= 0.04045) ? v / 12.92 : pow((v + 0.055) / 1.055, 2.4);
+}
+
+static double refEncode(double v) {
+    if (v < 0.0) v = 0.0;
+    if (v > 1.0) v = 1.0;
+    return 255.0 * ((v <= 0.0031308) ? v * 12.92 : 1.055 * pow(v, 1.0 / 2.4) - 0.055);
+}
+
+static double refChannel(const Pixel *p, int c) {
+    return (c == 0) ? p->r : (c == 1) ? p->g : p->b;
+}
+
+static void refSample(const Image *img, double x, double y, int linear, double out[3]) {
+    double maxX = (float)img->width - 1.001f, maxY = (float)img->height - 1.001f;
+    double fx, fy;
+    int x0, y0, x1, y1, c;
+
+    if (maxX < 0.0) maxX = 0.0;
+    if (maxY < 0.0) maxY = 0.0;
+    if (x < 0.0) x = 0.0;
+    if (x > maxX) x = maxX;
+    if (y < 0.0) y = 0.0;
+    if (y > maxY) y = maxY;
+
+    x0 = (int)floor(x);
+    y0 = (int)floor(y);
+    x1 = (x0 + 1 < img->width) ? x0 + 1 : img->width - 1;
+    y1 = (y0 + 1 < img->height) ? y0 + 1 : img->height - 1;
+    fx = x - x0;
+    fy = y - y0;
+
+    for (c = 0; c < 3; c++) {
+        double f00 = refChannel(&img->data[y0 * img->width + x0], c);
+        double f10 = refChannel(&img->data[y0 * img->width + x1], c);
+        double f01 = refChannel(&img->data[y1 * img->width + x0], c);
+        double f11 = refChannel(&img->data[y1 * img->width + x1], c);
+        double v;
+
+        if (linear) {
+            f00 = refDecode(f00);
+            f10 = refDecode(f10);
+            f01 = refDecode(f01);
+            f11 = refDecode(f11);
+        }
+
+        v = f00 * (1.0 - fx) * (1.0 - fy) + f10 * fx * (1.0 - fy) +
+            f01 * (1.0 - fx) * fy + f11 * fx * fy;
+
+        out[c] = linear ? refEncode(v) : v;
+    }
+}
+
+/* Max absolute error hasil backend terhadap referensi */
+static double maxError(const Image *src, const Image *result, int linear) {
+    float scaleX = (float)src->width / result->width;
+    float scaleY = (float)src->height / result->height;
+    double worst = 0.0;
+    int x, y, c;
+
+    for (y = 0; y < result->height; y++) {
+        for (x = 0; x < result->width; x++) {
+            const Pixel *p = &result->data[y * result->width + x];
+            double ref[3];
+
+            refSample(src, (double)(x * scaleX), (double)(y * scaleY), linear, ref);
+            for (c = 0; c < 3; c++) {
+                double err = fabs(refChannel(p, c) - ref[c]);
+                if (err > worst || err != err) worst = (err != err) ? 1e9 : err;
+            }
+        }
+    }
+    return worst;
+}
+
+#ifndef TEST_LEGACY
+/* Referensi RGBA: premultiply, interpolasi, unpremultiply (0 jika a <= eps) */
+static void refSampleRGBA(const ImageRGBA *img, double x, double y, double out[4]) {
+    double maxX = (float)img->width - 1.001f, maxY = (float)img->height - 1.001f;
+    const PixelRGBA *f[4];
+    double w[4], fx, fy, a = 0.0, rgb[3] = {0.0, 0.0, 0.0};
+    int x0, y0, x1, y1, i;
+
+    if (maxX < 0.0) maxX = 0.0;
+    if (maxY < 0.0) maxY = 0.0;
+    if (x < 0.0) x = 0.0;
+    if (x > maxX) x = maxX;
+    if (y < 0.0) y = 0.0;
+    if (y > maxY) y = maxY;
+
+    x0 = (int)floor(x);
+    y0 = (int)floor(y);
+    x1 = (x0 + 1 < img->width) ? x0 + 1 : img->width - 1;
+    y1 = (y0 + 1 < img->height) ? y0 + 1 : img->height - 1;
+    fx = x - x0;
+    fy = y - y0;
+
+    f[0] = &img->data[y0 * img->width + x0];
+    f[1] = &img->data[y0 * img->width + x1];
+    f[2] = &img->data[y1 * img->width + x0];
+    f[3] = &img->data[y1 * img->width + x1];
+    w[0] = (1.0 - fx) * (1.0 - fy);
+    w[1] = fx * (1.0 - fy);
+    w[2] = (1.0 - fx) * fy;
+    w[3] = fx * fy;
+
+    for (i = 0; i < 4; i++) {
+        double s = w[i] * f[i]->a / 255.0;
+        rgb[0] += f[i]->r * s;
+        rgb[1] += f[i]->g * s;
+        rgb[2] += f[i]->b * s;
+        a += f[i]->a * w[i];
+    }
+
+    for (i = 0; i < 3; i++) out[i] = (a > RGBA_ALPHA_EPS) ? rgb[i] * 255.0 / a : 0.0;
+    out[3] = a;
+}
+
+static double maxErrorRGBA(const ImageRGBA *src, const ImageRGBA *result) {
+    float scaleX = (float)src->width / result->width;
+    float scaleY = (float)src->height / result->height;
+    double worst = 0.0;
+    int x, y, c;
+
+    for (y = 0; y < result->height; y++) {
+        for (x = 0; x < result->width; x++) {
+            const PixelRGBA *p = &result->data[y * result->width + x];
+            double got[4], ref[4];
+
+            got[0] = p->r;
+            got[1] = p->g;
+            got[2] = p->b;
+            got[3] = p->a;
+            refSampleRGBA(src, (double)(x * scaleX), (double)(y * scaleY), ref);
+            for (c = 0; c < 4; c++) {
+                double err = fabs(got[c] - ref[c]);
+                if (err > worst || err != err) worst = (err != err) ? 1e9 : err;
+            }
+        }
+    }
+    return worst;
+}
+#endif
+
+/* ============================================================================
+ * TEST IMAGE & TIMER
+ * ============================================================================ */
+
+/* Noise deterministik (integer 0-255, channel berbeda) */
+static Image* createNoiseImage(int width, int height, unsigned seed) {
+    Image *img = createImage(width, height);
+    int i;
+
+    if (!img) return NULL;
+
+    for (i = 0; i < width * height; i++) {
+        seed = seed * 1103515245u + 12345u;
+        img->data[i].r = (float)((seed >> 8) & 255);
+        img->data[i].g = (float)((seed >> 16) & 255);
+        img->data[i].b = (float)((seed >> 24) & 255);
+    }
+    return img;
+}
+
+#ifndef TEST_LEGACY
+/*
+ * Noise RGBA, sekitar 1/4 pixel transparan penuh dan 1/16 pixel dengan
+ * alpha sangat kecil (termasuk denormal) untuk jalur unpremultiply.
+ */
+static ImageRGBA* createNoiseImageRGBA(int width, int height, unsigned seed) {
+    static const float tinyAlpha[4] = {1e-7f, 1e-20f, 1e-30f, 1e-40f};
+    ImageRGBA *img = createImageRGBA(width, height);
+    int i;
+
+    if (!img) return NULL;
+
+    for (i = 0; i < width * height; i++) {
+        seed = seed * 1103515245u + 12345u;
+        img->data[i].r = (float)((seed >> 8) & 255);
+        img->data[i].g = (float)((seed >> 16) & 255);
+        img->data[i].b = (float)((seed >> 24) & 255);
+        seed = seed * 1103515245u + 12345u;
+        img->data[i].a = ((seed >> 20) & 3) ? (float)((seed >> 8) & 255) : 0.0f;
+        if (((seed >> 20) & 15) == 4) img->data[i].a = tinyAlpha[(seed >> 24) & 3];
+    }
+    return img;
+}
+#endif
+
+static double testTimeMs() {
+#ifdef USE_OPENMP
+    return omp_get_wtime() * 1000.0;
+#else
+    return (double)clock() / CLOCKS_PER_SEC * 1000.0;
+#endif
+}
+
+/* ============================================================================
+ * TEST AKURASI
+ * ============================================================================ */
+
+typedef struct {
+    int srcW, srcH, dstW, dstH;
+    const char *label;
+} TestCase;
+
+static const TestCase testCases[] = {
+    {  1,   1,   1,   1, "1x1 identity"},
+    {  1,   1,   7,   5, "1x1 upscale"},
+    {  7,   5,   1,   1, "downscale to 1x1"},
+    {  1,  17,   9,   3, "single column"},
+    { 17,   1,   3,   9, "single row"},
+    { 33,   7, 100,  21, "non-square odd width"},
+    {301,  97,  97, 301, "transpose aspect"},
+    {640, 480,  17,  13, "extreme downscale"},
+    {  4,   3, 512, 384, "extreme upscale 128x"},
+    {  2,   2, 257, 255, "2x2 to odd"},
+    {255, 255, 256, 256, "near identity"},
+    { 64,  64,  64,  64, "identity"},
+};
+
+#define NUM_CASES ((int)(sizeof(testCases) / sizeof(testCases[0])))
+
+#ifndef TEST_LEGACY
+/*
+ * VirtualImage concurrent: STRESS_THREADS thread acquire/release tile
+ * viewport 4x3 yang bergeser, dengan cache 2 tile (lebih kecil dari
+ * viewport, eviction terus-menerus) dan prefetch async sebagai task.
+ * Setiap tile dibandingkan dengan resizeSerial(); di akhir tidak boleh ada
+ * tile yang masih di-pin dan cache harus kembali di bawah batas.
+ */
+#define STRESS_THREADS  4
+#define STRESS_FRAMES   48
+
+static long countBadPixels(const CachedTile *tile, const Image *ref) {
+    int x0 = tile->tx * VTILE_SIZE, y0 = tile->ty * VTILE_SIZE;
+    int x1 = mini(x0 + VTILE_SIZE, ref->width), y1 = mini(y0 + VTILE_SIZE, ref->height);
+    long bad = 0;
+    int x, y;
+
+    for (y = y0; y < y1; y++) {
+        for (x = x0; x < x1; x++) {
+            const Pixel *got = &tile->data[(y - y0) * VTILE_SIZE + (x - x0)];
+            const Pixel *want = &ref->data[y * ref->width + x];
+            if (got->r != want->r || got->g != want->g || got->b != want->b) bad++;
+        }
+    }
+    return bad;
+}
+
+static int runVirtualStress() {
+    int w = 8 * VTILE_SIZE - 37, h = 6 * VTILE_SIZE - 11;
+    Image *src = createNoiseImage(300, 200, 99u);
+    Image *ref = src ? resizeSerial(src, w, h) : NULL;
+    VirtualImage *vimg = ref ? createVirtualImage(src, w, h,
+                                                  2 * (size_t)VTILE_SIZE * VTILE_SIZE * sizeof(Pixel))
+                             : NULL;
+    long bad = 0, missing = 0, acquires = 0, pinned = 0;
+    const CachedTile *tile;
+    int f, ok;
+
+    printf("Case: virtual %dx%d, %d threads, cache 2 tiles < viewport 4x3\n",
+           w, h, STRESS_THREADS);
+
+    if (!vimg) {
+        printf("  [FAIL] virtual-stress no result\n");
+        freeImage(ref);
+        freeImage(src);
+        return 1;
+    }
+
+#ifdef USE_OPENMP
+    omp_set_num_threads(STRESS_THREADS);
+    #pragma omp parallel for schedule(dynamic) reduction(+:bad, missing, acquires)
+#endif
+    for (f = 0; f < STRESS_FRAMES * 12; f++) {
+        int frame = f / 12, i = f % 12;
+        int tx = (frame + i % 4) % vimg->tilesX;
+        int ty = (frame / 3 + i / 4) % vimg->tilesY;
+        CachedTile *t = virtualImageAcquireTile(vimg, tx, ty);
+
+        if (!t || t->tx != tx || t->ty != ty) {
+            missing++;
+            virtualImageReleaseTile(vimg, t);
+            continue;
+        }
+        acquires++;
+        bad += countBadPixels(t, ref);
+
+        /* Prefetch async selagi tile masih di-pin */
+        if (i == 11) virtualImagePrefetch(vimg, tx, ty, 1);
+        virtualImageReleaseTile(vimg, t);
+    }
+
+    for (tile = vimg->head; tile; tile = tile->next) {
+        if (tile->pinCount != 0) pinned++;
+    }
+
+    ok = bad == 0 && missing == 0 && pinned == 0 && vimg->numTiles <= vimg->maxTiles &&
+         vimg->hits + vimg->misses >= acquires;
+    printf("  [%s] %-14s %ld acquires, %ld bad pixels, %ld missing, %ld pinned, "
+           "%zu/%zu tiles cached\n", ok ? "PASS" : "FAIL", "virtual-stress", acquires,
+           bad, missing, pinned, vimg->numTiles, vimg->maxTiles);
+
+    freeVirtualImage(vimg);
+    freeImage(ref);
+    freeImage(src);
+    return ok ? 0 : 1;
+}
+
+/*
+ * Autotuner: saveCalibration -> loadCalibration -> lookupConfig dengan
+ * tabel kecil (bucket persis, bucket terdekat), baris rusak yang harus
+ * dilewati, dan file dari mesin dengan jumlah core berbeda.
+ */
+#define CALIB_TEST_FILE "test_calib.tmp"
+
+static int checkCalib(int ok, const char *what) {
+    printf("  [%s] %-14s %s\n", ok ? "PASS" : "FAIL", "calibration", what);
+    return ok ? 0 : 1;
+}
+
+static int sameConfig(ResizeConfig a, Backend backend, int threads, int tileSize) {
+    return a.backend == backend && a.threads == threads && a.tileSize == tileSize;
+}
+
+static int runCalibrationRoundTrip() {
+    int tiledSrc = sizeBucket(64, 64), tiledDst = sizeBucket(128, 128);
+    int ompSrc = sizeBucket(1024, 1024), ompDst = sizeBucket(2048, 2048);
+    int failures = 0, loaded;
+    ResizeConfig cfg;
+    FILE *f;
+
+    printf("Case: autotuner calibration round-trip (%s)\n", CALIB_TEST_FILE);
+
+    memset(calibTable, 0, sizeof(calibTable));
+    calibTable[tiledSrc][tiledDst].valid = 1;
+    calibTable[tiledSrc][tiledDst].config.backend = BACKEND_OPENMP_TILED;
+    calibTable[tiledSrc][tiledDst].config.threads = 1;
+    calibTable[tiledSrc][tiledDst].config.tileSize = 32;
+    calibTable[tiledSrc][tiledDst].timeMs = 0.5;
+    calibTable[ompSrc][ompDst].valid = 1;
+    calibTable[ompSrc][ompDst].config.backend = BACKEND_OPENMP;
+    calibTable[ompSrc][ompDst].config.threads = 1;
+    calibTable[ompSrc][ompDst].config.tileSize = 0;
+    calibTable[ompSrc][ompDst].timeMs = 80.0;
+
+    failures += checkCalib(saveCalibration(CALIB_TEST_FILE), "save");
+
+    /* Baris rusak: tiled tile 0, serial 2 thread, openmp 0 thread */
+    f = fopen(CALIB_TEST_FILE, "a");
+    if (f) {
+        fprintf(f, "4 11 2 1 0 1.0\n");
+        fprintf(f, "5 5 0 2 0 1.0\n");
+        fprintf(f, "6 6 1 0 0 1.0\n");
+        fclose(f);
+    }
+
+    memset(calibTable, 0, sizeof(calibTable));
+    loaded = loadCalibration(CALIB_TEST_FILE);
+    failures += checkCalib(loaded == 2, "load skips malformed lines");
+
+    cfg = lookupConfig(64, 64, 128, 128);
+    failures += checkCalib(sameConfig(cfg, BACKEND_OPENMP_TILED, 1, 32), "exact bucket");
+    cfg = lookupConfig(64, 64, 256, 256);
+    failures += checkCalib(sameConfig(cfg, BACKEND_OPENMP_TILED, 1, 32), "nearest bucket");
+    cfg = lookupConfig(1024, 1024, 2048, 2048);
+    failures += checkCalib(sameConfig(cfg, BACKEND_OPENMP, 1, 0), "exact bucket (openmp)");
+    cfg = lookupConfig(16, 16, 2048, 2048);
+    failures += checkCalib(cfg.backend != BACKEND_OPENMP_TILED || cfg.tileSize >= 1,
+                           "no tile 0 from malformed line");
+
+    /* File dari mesin dengan jumlah core berbeda */
+    f = fopen(CALIB_TEST_FILE, "w");
+    if (f) {
+        fprintf(f, "# bilinear calibration v1\n");
+        fprintf(f, "threads %d\n", maxThreadsAvailable() + 1);
+        fprintf(f, "%d %d 1 1 0 1.0\n", tiledSrc, tiledDst);
+        fclose(f);
+    }
+    loaded = loadCalibration(CALIB_TEST_FILE);
+    cfg = lookupConfig(64, 64, 128, 128);
+    failures += checkCalib(loaded == 0 && sameConfig(cfg, BACKEND_SERIAL, 1, 0),
+                           "core count mismatch rejected");
+
+    remove(CALIB_TEST_FILE);
+    memset(calibTable, 0, sizeof(calibTable));
+    return failures;
+}
+#endif
+
+static int runAccuracy() {
+    int failures = 0, c, b;
+
+    printf("\n");
+    printf("========================================================================\n");
+    printf("      REGRESSION: ACCURACY (%s, %d backends x %d cases)\n",
+           SUITE_NAME, NUM_BACKENDS + NUM_BACKENDS_RGBA, NUM_CASES);
+    printf("========================================================================\n\n");
+
+    for (c = 0; c < NUM_CASES; c++) {
+        const TestCase *tc = &testCases[c];
+        Image *src = createNoiseImage(tc->srcW, tc->srcH, 1234u + c);
+
+        printf("Case: %dx%d -> %dx%d (%s)\n", tc->srcW, tc->srcH, tc->dstW, tc->dstH, tc->label);
+
+        for (b = 0; b < NUM_BACKENDS; b++) {
+            const TestBackend *be = &backends[b];
+            double tol = be->linear ? TOL_LINEAR : TOL_GAMMA;
+            Image *result = src ? be->fn(src, tc->dstW, tc->dstH) : NULL;
+            double err;
+
+            if (!result || result->width != tc->dstW || result->height != tc->dstH) {
+                printf("  [FAIL] %-14s no result\n", be->name);
+                failures++;
+                freeImage(result);
+                continue;
+            }
+
+            err = maxError(src, result, be->linear);
+            if (err > tol) failures++;
+            printf("  [%s] %-14s max error %.5f (tol %.2f)\n",
+                   err > tol ? "FAIL" : "PASS", be->name, err, tol);
+
+            freeImage(result);
+        }
+
+#ifndef TEST_LEGACY
+        {
+            ImageRGBA *srcRgba = createNoiseImageRGBA(tc->srcW, tc->srcH, 4321u + c);
+
+            for (b = 0; b < NUM_BACKENDS_RGBA; b++) {
+                const TestBackendRGBA *be = &backendsRGBA[b];
+                ImageRGBA *result = srcRgba ? be->fn(srcRgba, tc->dstW, tc->dstH) : NULL;
+                double err;
+
+                if (!result || result->width != tc->dstW || result->height != tc->dstH) {
+                    printf("  [FAIL] %-14s no result\n", be->name);
+                    failures++;
+                    freeImageRGBA(result);
+                    continue;
+                }
+
+                err = maxErrorRGBA(srcRgba, result);
+                if (err > TOL_RGBA) failures++;
+                printf("  [%s] %-14s max error %.5f (tol %.2f)\n",
+                       err > TOL_RGBA ? "FAIL" : "PASS", be->name, err, TOL_RGBA);
+
+                freeImageRGBA(result);
+            }
+
+            freeImageRGBA(srcRgba);
+        }
+#endif
+
+        freeImage(src);
+    }
+
+#ifndef TEST_LEGACY
+    failures += runVirtualStress();
+    failures += runCalibrationRoundTrip();
+#endif
+
+    printf("\n%s: %d failure(s)\n", SUITE_NAME, failures);
+    printf("========================================================================\n");
+    return failures;
+}
+
+/* ============================================================================
+ * TEST PERFORMA (Throughput vs Baseline)
+ * ============================================================================
+ * Format baseline (teks): <suite>/<backend> <Mpix/s> <relatif vs serial>
+ * Baseline dibagi oleh kedua build; --update-baseline hanya mengganti
+ * entry milik suite ini.
+ *
+ * Backend selain serial dibandingkan lewat throughput relatif terhadap
+ * serial dari run yang sama (stabil antar mesin). Serial sendiri selalu
+ * dibandingkan dalam Mpix/s absolut: semua backend memakai kernel yang
+ * sama, jadi perlambatan kernel hanya terlihat di angka absolut serial.
+ * Karena itu baseline berlaku per mesin (rekam ulang dengan
+ * --update-baseline di mesin baru). --absolute membandingkan Mpix/s untuk
+ * semua backend. Entry parallel tetap bergantung pada jumlah core;
+ * baseline mencatat jumlah core mesin perekam.
+ * ============================================================================ */
+
+typedef struct {
+    char name[96];
+    double mpixPerSec;
+    double relSerial;   /* Throughput / serial (run yang sama), 0 = tidak ada */
+} PerfEntry;
+
+static int baselineCores = 0;
+
+static int loadBaseline(PerfEntry *entries, int maxEntries) {
+    FILE *f = fopen(PERF_BASELINE_FILE, "r");
+    char line[256];
+    int n = 0;
+
+    if (!f) return -1;
+
+    while (n < maxEntries && fgets(line, sizeof(line), f)) {
+        if (line[0] == '#') {
+            sscanf(line, "# cores: %d", &baselineCores);
+            continue;
+        }
+        entries[n].relSerial = 0.0;
+        if (sscanf(line, "%95s %lf %lf", entries[n].name, &entries[n].mpixPerSec,
+                   &entries[n].relSerial) >= 2) n++;
+    }
+
+    fclose(f);
+    return n;
+}
+
+static PerfEntry* findEntry(PerfEntry *entries, int n, const char *name) {
+    int i;
+    for (i = 0; i < n; i++) {
+        if (strcmp(entries[i].name, name) == 0) return &entries[i];
+    }
+    return NULL;
+}
+
+#define PERF_DST_SIZE 1024
+
+static int compareDoubles(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double median(double *values, int n) {
+    qsort(values, n, sizeof(double), compareDoubles);
+    return values[n / 2];
+}
+
+/* Waktu 1 run (ms), 512x512 -> PERF_DST_SIZE x PERF_DST_SIZE */
+typedef double (*TimeOnceFn)(const void *backend, const void *src);
+
+static double timeOnce(const void *backend, const void *src) {
+    double start = testTimeMs();
+    Image *result = ((const TestBackend*)backend)->fn((const Image*)src,
+                                                      PERF_DST_SIZE, PERF_DST_SIZE);
+    double elapsed = testTimeMs() - start;
+
+    freeImage(result);
+    return elapsed;
+}
+
+#ifndef TEST_LEGACY
+static double timeOnceRGBA(const void *backend, const void *src) {
+    double start = testTimeMs();
+    ImageRGBA *result = ((const TestBackendRGBA*)backend)->fn((const ImageRGBA*)src,
+                                                              PERF_DST_SIZE, PERF_DST_SIZE);
+    double elapsed = testTimeMs() - start;
+
+    freeImageRGBA(result);
+    return elapsed;
+}
+#endif
+
+/*
+ * Ukur 1 backend: median dari minimal PERF_MIN_REPS run dan PERF_MIN_TIME_MS
+ * total. Setiap run diselingi 1 run serial, dan rel = median(waktu serial)
+ * / median(waktu backend), sehingga perubahan kecepatan mesin selama
+ * pengukuran mengenai keduanya.
+ * @return throughput backend (Mpix/s); *rel = relatif terhadap serial
+ */
+static double measurePerf(TimeOnceFn fn, const void *backend, const void *src,
+                          const Image *serialSrc, double *rel) {
+    double times[PERF_MAX_REPS], serialTimes[PERF_MAX_REPS], total = 0.0, t, ts;
+    int r = 0;
+
+    while (r < PERF_MAX_REPS && (r < PERF_MIN_REPS || total < PERF_MIN_TIME_MS)) {
+        serialTimes[r] = timeOnce(&backends[0], serialSrc);
+        times[r] = fn(backend, src);
+        total += times[r++];
+    }
+
+    t = median(times, r);
+    ts = median(serialTimes, r);
+    *rel = ts / t;
+    return (double)PERF_DST_SIZE * PERF_DST_SIZE / (t / 1000.0) / 1e6;
+}
+
+/**
+ * Simpan (update) atau bandingkan 1 hasil dengan baseline.
+ * @return 1 jika lebih lambat dari baseline di luar toleransi
+ */
+static int recordPerf(PerfEntry *entries, int *numEntries, const char *backend,
+                      double mpix, double rel, int updateBaseline,
+                      double tolerance, int absolute) {
+    char name[96];
+    PerfEntry *e;
+    int slow;
+
+    snprintf(name, sizeof(name), "%s/%s", SUITE_NAME, backend);
+    e = findEntry(entries, *numEntries, name);
+
+    if (updateBaseline) {
+        if (!e && *numEntries < PERF_MAX_ENTRIES) {
+            e = &entries[(*numEntries)++];
+            snprintf(e->name, sizeof(e->name), "%s", name);
+        }
+        if (e) {
+            e->mpixPerSec = mpix;
+            e->relSerial = rel;
+        }
+        printf("  [SAVE] %-14s %8.1f Mpix/s  |  x%.2f serial\n", backend, mpix, rel);
+        return 0;
+    }
+
+    if (!e) {
+        printf("  [SKIP] %-14s %8.1f Mpix/s  (no baseline)\n", backend, mpix);
+        return 0;
+    }
+
+    if (absolute || e->relSerial <= 0.0) {
+        slow = mpix < e->mpixPerSec * (1.0 - tolerance);
+        printf("  [%s] %-14s %8.1f Mpix/s  |  Baseline: %8.1f  (%+.0f%%)\n",
+               slow ? "FAIL" : "PASS", backend, mpix, e->mpixPerSec,
+               (mpix / e->mpixPerSec - 1.0) * 100.0);
+        return slow;
+    }
+
+    slow = rel < e->relSerial * (1.0 - tolerance);
+    printf("  [%s] %-14s %8.1f Mpix/s  x%.2f serial  |  Baseline: x%.2f  (%+.0f%%)\n",
+           slow ? "FAIL" : "PASS", backend, mpix, rel, e->relSerial,
+           (rel / e->relSerial - 1.0) * 100.0);
+    return slow;
+}
+
+static int runPerf(int updateBaseline, double tolerance, int absolute) {
+    PerfEntry entries[PERF_MAX_ENTRIES];
+    Image *src = createNoiseImage(512, 512, 42u);
+    int numEntries, failures = 0, cores, b;
+
+    numEntries = loadBaseline(entries, PERF_MAX_ENTRIES);
+    if (numEntries < 0) {
+        if (!updateBaseline) {
+            printf("Error: %s not found (run with --update-baseline)\n", PERF_BASELINE_FILE);
+            freeImage(src);
+            return 1;
+        }
+        numEntries = 0;
+    }
+
+    printf("\n");
+    printf("========================================================================\n");
+    printf("      REGRESSION: PERFORMANCE (%s, 512x512 -> 1024x1024)\n", SUITE_NAME);
+    printf("========================================================================\n\n");
+
+#ifdef USE_OPENMP
+    cores = omp_get_num_procs();
+#else
+    cores = 1;
+#endif
+    if (!updateBaseline && baselineCores > 0 && baselineCores != cores) {
+        printf("  Note: baseline recorded on %d core(s), this machine has %d;\n"
+               "        parallel backends are not comparable\n\n", baselineCores, cores);
+    }
+
+    /* backends[0] adalah serial: acuan relatif, dicek absolut */
+    for (b = 0; b < NUM_BACKENDS; b++) {
+        double rel, mpix = measurePerf(timeOnce, &backends[b], src, src, &rel);
+        failures += recordPerf(entries, &numEntries, backends[b].name, mpix, rel,
+                               updateBaseline, tolerance, absolute || b == 0);
+    }
+
+#ifndef TEST_LEGACY
+    {
+        ImageRGBA *srcRgba = createNoiseImageRGBA(512, 512, 42u);
+
+        for (b = 0; srcRgba && b < NUM_BACKENDS_RGBA; b++) {
+            double rel, mpix = measurePerf(timeOnceRGBA, &backendsRGBA[b], srcRgba, src, &rel);
+            failures += recordPerf(entries, &numEntries, backendsRGBA[b].name, mpix, rel,
+                                   updateBaseline, tolerance, absolute);
+        }
+
+        freeImageRGBA(srcRgba);
+    }
+#endif
+
+    freeImage(src);
+
+    if (updateBaseline) {
+        FILE *f = fopen(PERF_BASELINE_FILE, "w");
+        int i;
+
+        if (!f) {
+            printf("Error: Failed to write %s\n", PERF_BASELINE_FILE);
+            return 1;
+        }
+        fprintf(f, "# bilinear perf baseline: <suite>/<backend> <Mpix/s> <relative to serial>\n");
+        fprintf(f, "# cores: %d\n", cores);
+        for (i = 0; i < numEntries; i++) {
+            fprintf(f, "%s %.1f %.3f\n", entries[i].name, entries[i].mpixPerSec,
+                    entries[i].relSerial);
+        }
+        fclose(f);
+        printf("\nBaseline saved to %s\n", PERF_BASELINE_FILE);
+    } else {
+        printf("\n%s: %d regression(s) (tolerance %.0f%%)\n", SUITE_NAME, failures, tolerance * 100.0);
+    }
+    printf("========================================================================\n");
+    return failures;
+}
+
+/* ============================================================================
+ * MAIN
+ * ============================================================================ */
+
+int main(int argc, char **argv) {
+    double tolerance = PERF_TOLERANCE;
+    int perf = 0, update = 0, absolute = 0, i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--perf") == 0) {
+            perf = 1;
+        } else if (strcmp(argv[i], "--update-baseline") == 0) {
+            update = 1;
+        } else if (strcmp(argv[i], "--absolute") == 0) {
+            absolute = 1;
+        } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = atof(argv[++i]);
+        } else {
+            printf("Usage: %s [--perf [--tolerance t] [--absolute] | --update-baseline]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (perf || update) return runPerf(update, tolerance, absolute) ? 1 : 0;
+    return runAccuracy() ? 1 : 0;
+}